@@ -3,6 +3,7 @@ import os
 import configparser
 import pyassimp
 import pathlib
+import math
 
 # Extract cmd line arguments.
 input_dir = sys.argv[1]
@@ -85,9 +86,20 @@ constexpr TriangleIndices %MODEL_NAME%_triangles[%MODEL_NAME%_triangle_number] =
     %TRIANGLE_ENTRIES%
 };
 
+constexpr int32 %MODEL_NAME%_cluster_number = %CLUSTER_NUMBER%;
+
+template<typename T>
+constexpr ModelCluster<T> %MODEL_NAME%_clusters[%MODEL_NAME%_cluster_number] = {
+    %CLUSTER_ENTRIES%
+};
+
+template<typename T>
+constexpr ModelBounds<T> %MODEL_NAME%_bounds = {{%BOUNDS_MIN%}, {%BOUNDS_MAX%}};
+
 template<typename T, ShaderConfiguration t_cfg>
 constexpr typename %SHADER_NAME%ShaderInterface<T, t_cfg>::ModelData %MODEL_NAME%_model = {
-    %MODEL_NAME%_vertex_number, %MODEL_NAME%_triangle_number, %MODEL_NAME%_vertices<T>, %MODEL_NAME%_triangles
+    %MODEL_NAME%_vertex_number, %MODEL_NAME%_triangle_number, %MODEL_NAME%_vertices<T>, %MODEL_NAME%_triangles,
+    &%MODEL_NAME%_bounds<T>, %MODEL_NAME%_cluster_number, %MODEL_NAME%_clusters<T>
 };
 '''
 
@@ -96,6 +108,90 @@ header_template = header_template.replace('%SHADER_DIRECTORY%', shader_directory
 header_template = header_template.replace('%SHADER_NAME%', shader_name)
 
 
+# Triangles per cluster, the renderer rejects clusters that are off screen or back-facing as a whole.
+max_cluster_triangles = 64
+
+
+def build_clusters(positions, faces):
+    """Groups triangles into clusters of neighboring triangles with similar normals. Returns the triangles reordered so
+    that clusters are consecutive, each cluster's triangles in their original order, and the clusters as tuples of
+    first triangle, triangle number, bounds minimum and maximum, normal cone axis, cosine and sine."""
+    def sub(a, b):
+        return [a[0] - b[0], a[1] - b[1], a[2] - b[2]]
+
+    def dot(a, b):
+        return a[0] * b[0] + a[1] * b[1] + a[2] * b[2]
+
+    def normalize(a):
+        length = math.sqrt(dot(a, a))
+        return [value / length for value in a] if length > 0.0 else [0.0, 0.0, 0.0]
+
+    # Unit normals (v2 - v1) x (v3 - v1), zero for degenerate triangles.
+    normals = []
+    for face in faces:
+        e1 = sub(positions[face[1]], positions[face[0]])
+        e2 = sub(positions[face[2]], positions[face[0]])
+        normals.append(normalize([e1[1] * e2[2] - e1[2] * e2[1], e1[2] * e2[0] - e1[0] * e2[2],
+                                  e1[0] * e2[1] - e1[1] * e2[0]]))
+
+    # Triangles sharing a vertex position are neighbors.
+    position_triangles = {}
+    for t_idx, face in enumerate(faces):
+        for v_idx in face:
+            position_triangles.setdefault(tuple(positions[v_idx]), []).append(t_idx)
+
+    # Centroids for continuing clusters across separate parts of the mesh.
+    centroids = [[sum(positions[v_idx][axis] for v_idx in face) / 3.0 for axis in range(3)] for face in faces]
+
+    # Grow clusters from the first unassigned triangle, always adding the neighbor closest to the cluster's mean
+    # normal, as long as the normals stay within 60 degrees of it. Without such neighbors, the cluster continues with
+    # the nearest unassigned triangle whose normal does.
+    assigned = [False] * len(faces)
+    clusters = []
+    for seed in range(len(faces)):
+        if assigned[seed]:
+            continue
+        cluster = [seed]
+        assigned[seed] = True
+        normal_sum = list(normals[seed])
+        candidates = set()
+        while len(cluster) < max_cluster_triangles:
+            for v_idx in faces[cluster[-1]]:
+                candidates.update(t for t in position_triangles[tuple(positions[v_idx])] if not assigned[t])
+            axis = normalize(normal_sum)
+            candidates = {t for t in candidates if not assigned[t] and dot(normals[t], axis) >= 0.5}
+            if candidates:
+                best = max(candidates, key=lambda t: (dot(normals[t], axis), -t))
+            else:
+                center = centroids[seed]
+                distant = [t for t in range(seed + 1, len(faces)) if not assigned[t] and dot(normals[t], axis) >= 0.5]
+                if not distant:
+                    break
+                best = min(distant, key=lambda t: (dot(sub(centroids[t], center), sub(centroids[t], center)), t))
+            cluster.append(best)
+            assigned[best] = True
+            normal_sum = [a + b for a, b in zip(normal_sum, normals[best])]
+        clusters.append(sorted(cluster))
+
+    # Reorder triangles and compute the clusters' bounds and normal cones.
+    ordered_faces = []
+    cluster_data = []
+    for cluster in clusters:
+        first_triangle = len(ordered_faces)
+        ordered_faces.extend(faces[t] for t in cluster)
+        cluster_positions = [positions[v_idx] for t in cluster for v_idx in faces[t]]
+        bounds_min = [min(position[axis] for position in cluster_positions) for axis in range(3)]
+        bounds_max = [max(position[axis] for position in cluster_positions) for axis in range(3)]
+        cone_axis = normalize([sum(normals[t][axis] for t in cluster) for axis in range(3)])
+        cone_normals = [normals[t] for t in cluster if normals[t] != [0.0, 0.0, 0.0]]
+        cone_cos = min((dot(normal, cone_axis) for normal in cone_normals), default=-1.0)
+        if cone_axis == [0.0, 0.0, 0.0] or cone_cos <= 0.0:
+            cone_cos = -1.0
+        cone_sin = math.sqrt(max(1.0 - cone_cos * cone_cos, 0.0))
+        cluster_data.append((first_triangle, len(cluster), bounds_min, bounds_max, cone_axis, cone_cos, cone_sin))
+    return ordered_faces, cluster_data
+
+
 def convert_model(model_file_name):
     # Construct model input file path.
     model_in_path = os.path.join(input_dir, model_file_name)
@@ -132,17 +228,31 @@ def convert_model(model_file_name):
                     return
                 vs_elem_ordered_assimp.append(source)
 
-            # Prepare triangle indices for model header.
-            triangle_indices = ''
+            # Group triangles into clusters, which reorders them.
             triangle_number = len(mesh.faces)
             for t_idx in range(triangle_number):
                 if len(mesh.faces[t_idx]) != 3:
                     print('Error: Assimp found non-triangle faces in mesh: "{}"!'.format(model_in_path))
                     return
-                new_entry = str(mesh.faces[t_idx]).replace('[', '{').replace(']', '}')
+            positions = [[float(value) for value in position] for position in mesh.vertices]
+            faces = [[int(v_idx) for v_idx in face] for face in mesh.faces]
+            ordered_faces, clusters = build_clusters(positions, faces)
+
+            # Prepare triangle indices for model header.
+            triangle_indices = ''
+            for face in ordered_faces:
+                new_entry = str(face).replace('[', '{').replace(']', '}')
                 triangle_indices += new_entry + ',\n\t'
             triangle_indices = triangle_indices[:-3]
 
+            # Prepare clusters for model header.
+            cluster_entries = ''
+            for first_triangle, num_triangles, c_min, c_max, cone_axis, cone_cos, cone_sin in clusters:
+                cluster_entries += '{{{}, {}, {{{{{}}}, {{{}}}}}, {{{}}}, {}, {}}},\n\t'.format(
+                    first_triangle, num_triangles, ', '.join(map(str, c_min)), ', '.join(map(str, c_max)),
+                    ', '.join(map(str, cone_axis)), cone_cos, cone_sin)
+            cluster_entries = cluster_entries[:-3]
+
             # Prepare vertex sources for model header.
             vertex_sources = ''
             vertex_number = len(mesh.vertices)
@@ -158,6 +268,10 @@ def convert_model(model_file_name):
                 vertex_sources += '{' + new_source[:-2] + '},\n\t'
             vertex_sources = vertex_sources[:-3]
 
+            # Prepare axis-aligned bounding box of vertex positions for model header.
+            bounds_min = [min(position[axis] for position in positions) for axis in range(3)]
+            bounds_max = [max(position[axis] for position in positions) for axis in range(3)]
+
             # Insert information into model header.
             model_name = str(pathlib.Path(model_file_name).with_suffix(''))
             converted_model = header_template.replace('%MODEL_NAME%', model_name)
@@ -165,6 +279,10 @@ def convert_model(model_file_name):
             converted_model = converted_model.replace('%VERTEX_NUMBER%', str(vertex_number))
             converted_model = converted_model.replace('%TRIANGLE_ENTRIES%', triangle_indices)
             converted_model = converted_model.replace('%VERTEX_ENTRIES%', vertex_sources)
+            converted_model = converted_model.replace('%CLUSTER_NUMBER%', str(len(clusters)))
+            converted_model = converted_model.replace('%CLUSTER_ENTRIES%', cluster_entries)
+            converted_model = converted_model.replace('%BOUNDS_MIN%', ', '.join(str(value) for value in bounds_min))
+            converted_model = converted_model.replace('%BOUNDS_MAX%', ', '.join(str(value) for value in bounds_max))
 
             # Write header file in output directory.
             model_out_path = os.path.join(output_dir, model_name + '.h')
@@ -56,20 +56,36 @@ constexpr int32 cube_triangle_number = 12;
 
 constexpr TriangleIndices cube_triangles[cube_triangle_number] = {
     {0, 1, 2},
-	{3, 4, 5},
-	{6, 7, 8},
-	{9, 10, 11},
-	{12, 13, 14},
-	{15, 16, 17},
 	{18, 19, 20},
+	{3, 4, 5},
 	{21, 22, 23},
+	{6, 7, 8},
 	{24, 25, 26},
+	{9, 10, 11},
 	{27, 28, 29},
+	{12, 13, 14},
 	{30, 31, 32},
+	{15, 16, 17},
 	{33, 34, 35}
 };
 
+constexpr int32 cube_cluster_number = 6;
+
+template<typename T>
+constexpr ModelCluster<T> cube_clusters[cube_cluster_number] = {
+    {0, 2, {{-1.0, -1.0, 1.0}, {1.0, 1.0, 1.0}}, {0.0, 0.0, 1.0}, 1.0, 0.0},
+	{2, 2, {{-1.0, -1.0, -1.0}, {1.0, -1.0, 1.0}}, {0.0, -1.0, 0.0}, 1.0, 0.0},
+	{4, 2, {{-1.0, -1.0, -1.0}, {-1.0, 1.0, 1.0}}, {-1.0, 0.0, 0.0}, 1.0, 0.0},
+	{6, 2, {{-1.0, -1.0, -1.0}, {1.0, 1.0, -1.0}}, {0.0, 0.0, -1.0}, 1.0, 0.0},
+	{8, 2, {{1.0, -1.0, -1.0}, {1.0, 1.0, 1.0}}, {1.0, 0.0, 0.0}, 1.0, 0.0},
+	{10, 2, {{-1.0, 1.0, -1.0}, {1.0, 1.0, 1.0}}, {0.0, 1.0, 0.0}, 1.0, 0.0}
+};
+
+template<typename T>
+constexpr ModelBounds<T> cube_bounds = {{-1.0, -1.0, -1.0}, {1.0, 1.0, 1.0}};
+
 template<typename T, ShaderConfiguration t_cfg>
 constexpr typename GouraudTexturedShaderInterface<T, t_cfg>::ModelData cube_model = {
-    cube_vertex_number, cube_triangle_number, cube_vertices<T>, cube_triangles
+    cube_vertex_number, cube_triangle_number, cube_vertices<T>, cube_triangles,
+    &cube_bounds<T>, cube_cluster_number, cube_clusters<T>
 };
@@ -24,10 +24,21 @@ constexpr int32 plane_triangle_number = 2;
 
 constexpr TriangleIndices plane_triangles[plane_triangle_number] = {
     {0, 1, 2},
-    {0, 2, 3}
+	{0, 2, 3}
 };
 
+constexpr int32 plane_cluster_number = 1;
+
+template<typename T>
+constexpr ModelCluster<T> plane_clusters[plane_cluster_number] = {
+    {0, 2, {{-1.0, -1.0, -0.0}, {1.0, 1.0, -0.0}}, {0.0, 0.0, 1.0}, 1.0, 0.0}
+};
+
+template<typename T>
+constexpr ModelBounds<T> plane_bounds = {{-1.0, -1.0, -0.0}, {1.0, 1.0, -0.0}};
+
 template<typename T, ShaderConfiguration t_cfg>
 constexpr typename GouraudTexturedShaderInterface<T, t_cfg>::ModelData plane_model = {
-    plane_vertex_number, plane_triangle_number, plane_vertices<T>, plane_triangles
+    plane_vertex_number, plane_triangle_number, plane_vertices<T>, plane_triangles,
+    &plane_bounds<T>, plane_cluster_number, plane_clusters<T>
 };
@@ -27,10 +27,26 @@ constexpr SimpleContoursVertexSource<T> cube_vertices[cube_vertex_number] = {
 constexpr int32 cube_triangle_number = 12;
 
 constexpr TriangleIndices cube_triangles[cube_triangle_number] = {
-    4, 2, 0, 2, 7, 3, 6, 5, 7, 1, 7, 5, 0, 3, 1, 4, 1, 5, 4, 6, 2, 2, 6, 7, 6, 4, 5, 1, 3, 7, 0, 2, 3, 4, 0, 1
+    4, 2, 0, 4, 6, 2, 2, 7, 3, 2, 6, 7, 6, 5, 7, 6, 4, 5, 1, 7, 5, 1, 3, 7, 0, 3, 1, 0, 2, 3, 4, 1, 5, 4, 0, 1
 };
 
+constexpr int32 cube_cluster_number = 6;
+
+template<typename T>
+constexpr ModelCluster<T> cube_clusters[cube_cluster_number] = {
+    {0, 2, {{-0.5, 0.5, -0.5}, {0.5, 0.5, 0.5}}, {0.0, 1.0, 0.0}, 1.0, 0.0},
+	{2, 2, {{-0.5, -0.5, 0.5}, {0.5, 0.5, 0.5}}, {0.0, 0.0, 1.0}, 1.0, 0.0},
+	{4, 2, {{-0.5, -0.5, -0.5}, {-0.5, 0.5, 0.5}}, {-1.0, 0.0, 0.0}, 1.0, 0.0},
+	{6, 2, {{-0.5, -0.5, -0.5}, {0.5, -0.5, 0.5}}, {0.0, -1.0, 0.0}, 1.0, 0.0},
+	{8, 2, {{0.5, -0.5, -0.5}, {0.5, 0.5, 0.5}}, {1.0, 0.0, 0.0}, 1.0, 0.0},
+	{10, 2, {{-0.5, -0.5, -0.5}, {0.5, 0.5, -0.5}}, {0.0, 0.0, -1.0}, 1.0, 0.0}
+};
+
+template<typename T>
+constexpr ModelBounds<T> cube_bounds = {{-0.5, -0.5, -0.5}, {0.5, 0.5, 0.5}};
+
 template<typename T, ShaderConfiguration t_cfg>
 constexpr typename SimpleContoursShaderInterface<T, t_cfg>::ModelData cube_model = {
-    cube_vertex_number, cube_triangle_number, cube_vertices<T>, cube_triangles
+    cube_vertex_number, cube_triangle_number, cube_vertices<T>, cube_triangles,
+    &cube_bounds<T>, cube_cluster_number, cube_clusters<T>
 };
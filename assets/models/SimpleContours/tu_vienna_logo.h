@@ -864,95 +864,8 @@ constexpr TriangleIndices tu_vienna_logo_triangles[tu_vienna_logo_triangle_numbe
 	{6, 7, 8},
 	{9, 10, 11},
 	{12, 13, 14},
-	{15, 16, 17},
 	{18, 19, 20},
 	{21, 22, 23},
-	{24, 25, 26},
-	{27, 28, 29},
-	{30, 31, 32},
-	{33, 34, 35},
-	{36, 37, 38},
-	{39, 40, 41},
-	{42, 43, 44},
-	{45, 46, 47},
-	{48, 49, 50},
-	{51, 52, 53},
-	{54, 55, 56},
-	{57, 58, 59},
-	{60, 61, 62},
-	{63, 64, 65},
-	{66, 67, 68},
-	{69, 70, 71},
-	{72, 73, 74},
-	{75, 76, 77},
-	{78, 79, 80},
-	{81, 82, 83},
-	{84, 85, 86},
-	{87, 88, 89},
-	{90, 91, 92},
-	{93, 94, 95},
-	{96, 97, 98},
-	{99, 100, 101},
-	{102, 103, 104},
-	{105, 106, 107},
-	{108, 109, 110},
-	{111, 112, 113},
-	{114, 115, 116},
-	{117, 118, 119},
-	{120, 121, 122},
-	{123, 124, 125},
-	{126, 127, 128},
-	{129, 130, 131},
-	{132, 133, 134},
-	{135, 136, 137},
-	{138, 139, 140},
-	{141, 142, 143},
-	{144, 145, 146},
-	{147, 148, 149},
-	{150, 151, 152},
-	{153, 154, 155},
-	{156, 157, 158},
-	{159, 160, 161},
-	{162, 163, 164},
-	{165, 166, 167},
-	{168, 169, 170},
-	{171, 172, 173},
-	{174, 175, 176},
-	{177, 178, 179},
-	{180, 181, 182},
-	{183, 184, 185},
-	{186, 187, 188},
-	{189, 190, 191},
-	{192, 193, 194},
-	{195, 196, 197},
-	{198, 199, 200},
-	{201, 202, 203},
-	{204, 205, 206},
-	{207, 208, 209},
-	{210, 211, 212},
-	{213, 214, 215},
-	{216, 217, 218},
-	{219, 220, 221},
-	{222, 223, 224},
-	{225, 226, 227},
-	{228, 229, 230},
-	{231, 232, 233},
-	{234, 235, 236},
-	{237, 238, 239},
-	{240, 241, 242},
-	{243, 244, 245},
-	{246, 247, 248},
-	{249, 250, 251},
-	{252, 253, 254},
-	{255, 256, 257},
-	{258, 259, 260},
-	{261, 262, 263},
-	{264, 265, 266},
-	{267, 268, 269},
-	{270, 271, 272},
-	{273, 274, 275},
-	{276, 277, 278},
-	{279, 280, 281},
 	{282, 283, 284},
 	{285, 286, 287},
 	{288, 289, 290},
@@ -1007,6 +920,14 @@ constexpr TriangleIndices tu_vienna_logo_triangles[tu_vienna_logo_triangle_numbe
 	{435, 436, 437},
 	{438, 439, 440},
 	{441, 442, 443},
+	{15, 16, 17},
+	{24, 25, 26},
+	{27, 28, 29},
+	{30, 31, 32},
+	{33, 34, 35},
+	{36, 37, 38},
+	{42, 43, 44},
+	{45, 46, 47},
 	{444, 445, 446},
 	{447, 448, 449},
 	{450, 451, 452},
@@ -1061,87 +982,186 @@ constexpr TriangleIndices tu_vienna_logo_triangles[tu_vienna_logo_triangle_numbe
 	{597, 598, 599},
 	{600, 601, 602},
 	{603, 604, 605},
+	{39, 40, 41},
+	{48, 49, 50},
+	{51, 52, 53},
+	{57, 58, 59},
+	{63, 64, 65},
+	{66, 67, 68},
+	{75, 76, 77},
+	{96, 97, 98},
+	{108, 109, 110},
+	{114, 115, 116},
+	{126, 127, 128},
+	{132, 133, 134},
+	{144, 145, 146},
+	{147, 148, 149},
+	{150, 151, 152},
+	{159, 160, 161},
+	{162, 163, 164},
+	{186, 187, 188},
+	{207, 208, 209},
+	{219, 220, 221},
+	{228, 229, 230},
+	{231, 232, 233},
+	{234, 235, 236},
+	{237, 238, 239},
+	{246, 247, 248},
+	{258, 259, 260},
+	{267, 268, 269},
+	{270, 271, 272},
 	{606, 607, 608},
 	{609, 610, 611},
-	{612, 613, 614},
 	{615, 616, 617},
-	{618, 619, 620},
 	{621, 622, 623},
 	{624, 625, 626},
-	{627, 628, 629},
-	{630, 631, 632},
 	{633, 634, 635},
+	{654, 655, 656},
+	{666, 667, 668},
+	{672, 673, 674},
+	{684, 685, 686},
+	{690, 691, 692},
+	{702, 703, 704},
+	{705, 706, 707},
+	{708, 709, 710},
+	{717, 718, 719},
+	{720, 721, 722},
+	{744, 745, 746},
+	{765, 766, 767},
+	{777, 778, 779},
+	{786, 787, 788},
+	{789, 790, 791},
+	{792, 793, 794},
+	{795, 796, 797},
+	{804, 805, 806},
+	{816, 817, 818},
+	{825, 826, 827},
+	{828, 829, 830},
+	{54, 55, 56},
+	{60, 61, 62},
+	{78, 79, 80},
+	{81, 82, 83},
+	{84, 85, 86},
+	{87, 88, 89},
+	{93, 94, 95},
+	{99, 100, 101},
+	{102, 103, 104},
+	{111, 112, 113},
+	{117, 118, 119},
+	{120, 121, 122},
+	{123, 124, 125},
+	{129, 130, 131},
+	{135, 136, 137},
+	{153, 154, 155},
+	{156, 157, 158},
+	{165, 166, 167},
+	{168, 169, 170},
+	{180, 181, 182},
+	{189, 190, 191},
+	{192, 193, 194},
+	{195, 196, 197},
+	{213, 214, 215},
+	{216, 217, 218},
+	{222, 223, 224},
+	{240, 241, 242},
+	{243, 244, 245},
+	{249, 250, 251},
+	{252, 253, 254},
+	{276, 277, 278},
+	{279, 280, 281},
+	{612, 613, 614},
+	{618, 619, 620},
 	{636, 637, 638},
 	{639, 640, 641},
 	{642, 643, 644},
 	{645, 646, 647},
-	{648, 649, 650},
 	{651, 652, 653},
-	{654, 655, 656},
 	{657, 658, 659},
 	{660, 661, 662},
-	{663, 664, 665},
-	{666, 667, 668},
 	{669, 670, 671},
-	{672, 673, 674},
 	{675, 676, 677},
 	{678, 679, 680},
 	{681, 682, 683},
-	{684, 685, 686},
 	{687, 688, 689},
-	{690, 691, 692},
 	{693, 694, 695},
-	{696, 697, 698},
-	{699, 700, 701},
-	{702, 703, 704},
-	{705, 706, 707},
-	{708, 709, 710},
 	{711, 712, 713},
 	{714, 715, 716},
-	{717, 718, 719},
-	{720, 721, 722},
 	{723, 724, 725},
 	{726, 727, 728},
-	{729, 730, 731},
-	{732, 733, 734},
-	{735, 736, 737},
 	{738, 739, 740},
-	{741, 742, 743},
-	{744, 745, 746},
 	{747, 748, 749},
 	{750, 751, 752},
 	{753, 754, 755},
-	{756, 757, 758},
-	{759, 760, 761},
-	{762, 763, 764},
-	{765, 766, 767},
-	{768, 769, 770},
 	{771, 772, 773},
 	{774, 775, 776},
-	{777, 778, 779},
 	{780, 781, 782},
-	{783, 784, 785},
-	{786, 787, 788},
-	{789, 790, 791},
-	{792, 793, 794},
-	{795, 796, 797},
 	{798, 799, 800},
 	{801, 802, 803},
-	{804, 805, 806},
 	{807, 808, 809},
 	{810, 811, 812},
-	{813, 814, 815},
-	{816, 817, 818},
+	{834, 835, 836},
+	{837, 838, 839},
+	{69, 70, 71},
+	{72, 73, 74},
+	{90, 91, 92},
+	{105, 106, 107},
+	{138, 139, 140},
+	{141, 142, 143},
+	{171, 172, 173},
+	{177, 178, 179},
+	{183, 184, 185},
+	{198, 199, 200},
+	{201, 202, 203},
+	{204, 205, 206},
+	{210, 211, 212},
+	{225, 226, 227},
+	{261, 262, 263},
+	{627, 628, 629},
+	{630, 631, 632},
+	{648, 649, 650},
+	{663, 664, 665},
+	{696, 697, 698},
+	{699, 700, 701},
+	{729, 730, 731},
+	{735, 736, 737},
+	{741, 742, 743},
+	{756, 757, 758},
+	{759, 760, 761},
+	{762, 763, 764},
+	{768, 769, 770},
+	{783, 784, 785},
 	{819, 820, 821},
+	{174, 175, 176},
+	{255, 256, 257},
+	{264, 265, 266},
+	{732, 733, 734},
+	{813, 814, 815},
 	{822, 823, 824},
-	{825, 826, 827},
-	{828, 829, 830},
-	{831, 832, 833},
-	{834, 835, 836},
-	{837, 838, 839}
+	{273, 274, 275},
+	{831, 832, 833}
+};
+
+constexpr int32 tu_vienna_logo_cluster_number = 10;
+
+template<typename T>
+constexpr ModelCluster<T> tu_vienna_logo_clusters[tu_vienna_logo_cluster_number] = {
+    {0, 61, {{-1.9926660060882568, -2.0037031173706055, 0.0}, {2.109990119934082, 1.9844970703125, 0.0}}, {0.0, 0.0, -1.0}, 1.0, 0.0},
+	{61, 1, {{-0.7611150145530701, 1.1088980436325073, -0.0}, {-0.1843400001525879, 1.1088980436325073, -0.0}}, {0.0, 0.0, 0.0}, -1.0, 0.0},
+	{62, 61, {{-1.9926660060882568, -2.0037031173706055, 0.6206079721450806}, {2.109990119934082, 1.9844970703125, 0.6206089854240417}}, {0.0, 0.0, 1.0}, 1.0, 0.0},
+	{123, 1, {{-0.7611150145530701, 1.1088980436325073, 0.6206079721450806}, {-0.1843400001525879, 1.1088980436325073, 0.6206079721450806}}, {0.0, 0.0, 0.0}, -1.0, 0.0},
+	{124, 54, {{-1.9926660060882568, -2.0037031173706055, 0.0}, {1.8887519836425781, 1.9844970703125, 0.6206089854240417}}, {-0.9962998241497776, -0.08594568284167742, 0.0}, 0.08594568284167742, 0.9962998241497776},
+	{178, 64, {{-1.9926660060882568, -2.0037031173706055, 0.0}, {2.109990119934082, 1.9844970703125, 0.6206089854240417}}, {0.787907756305303, 0.6157932831348039, -4.9982098738930674e-08}, 0.58568687039004, 0.8105374080526576},
+	{242, 30, {{-1.9926660060882568, -2.0037031173706055, -0.0}, {2.109990119934082, 1.8317890167236328, 0.6206089854240417}}, {0.13062382822276172, -0.9914320024592864, 0.0}, 0.5899001109255239, 0.8074762282135955},
+	{272, 6, {{-1.6046099662780762, 0.27449700236320496, 0.0}, {-1.0783840417861938, 0.4780159890651703, 0.6206089854240417}}, {-0.36558567257848845, 0.9307776941919774, 0.0}, 0.9759993760235143, 0.21777331792878285},
+	{278, 1, {{-0.7611150145530701, 1.1088980436325073, -0.0}, {-0.7611150145530701, 1.1088980436325073, 0.6206079721450806}}, {0.0, 0.0, 0.0}, -1.0, 0.0},
+	{279, 1, {{-0.7611150145530701, 1.1088980436325073, -0.0}, {-0.7611150145530701, 1.1088980436325073, 0.6206079721450806}}, {0.0, 0.0, 0.0}, -1.0, 0.0}
 };
 
+template<typename T>
+constexpr ModelBounds<T> tu_vienna_logo_bounds = {{-1.9926660060882568, -2.0037031173706055, 0.0}, {2.109990119934082, 1.9844970703125, 0.6206089854240417}};
+
 template<typename T, ShaderConfiguration t_cfg>
 constexpr typename SimpleContoursShaderInterface<T, t_cfg>::ModelData tu_vienna_logo_model = {
-    tu_vienna_logo_vertex_number, tu_vienna_logo_triangle_number, tu_vienna_logo_vertices<T>, tu_vienna_logo_triangles
+    tu_vienna_logo_vertex_number, tu_vienna_logo_triangle_number, tu_vienna_logo_vertices<T>, tu_vienna_logo_triangles,
+    &tu_vienna_logo_bounds<T>, tu_vienna_logo_cluster_number, tu_vienna_logo_clusters<T>
 };
@@ -57,7 +57,23 @@ constexpr TriangleIndices cube_triangles[cube_triangle_number] = {
 	{20, 22, 23}
 };
 
+constexpr int32 cube_cluster_number = 6;
+
+template<typename T>
+constexpr ModelCluster<T> cube_clusters[cube_cluster_number] = {
+    {0, 2, {{-1.0, -1.0, -1.0}, {-1.0, 1.0, 1.0}}, {-1.0, 0.0, 0.0}, 1.0, 0.0},
+	{2, 2, {{-1.0, -1.0, -1.0}, {1.0, 1.0, -1.0}}, {0.0, 0.0, -1.0}, 1.0, 0.0},
+	{4, 2, {{1.0, -1.0, -1.0}, {1.0, 1.0, 1.0}}, {1.0, 0.0, 0.0}, 1.0, 0.0},
+	{6, 2, {{-1.0, -1.0, 1.0}, {1.0, 1.0, 1.0}}, {0.0, 0.0, 1.0}, 1.0, 0.0},
+	{8, 2, {{-1.0, -1.0, -1.0}, {1.0, -1.0, 1.0}}, {0.0, -1.0, 0.0}, 1.0, 0.0},
+	{10, 2, {{-1.0, 1.0, -1.0}, {1.0, 1.0, 1.0}}, {0.0, 1.0, 0.0}, 1.0, 0.0}
+};
+
+template<typename T>
+constexpr ModelBounds<T> cube_bounds = {{-1.0, -1.0, -1.0}, {1.0, 1.0, 1.0}};
+
 template<typename T, ShaderConfiguration t_cfg>
 constexpr typename UnlitTexturedShaderInterface<T, t_cfg>::ModelData cube_model = {
-    cube_vertex_number, cube_triangle_number, cube_vertices<T>, cube_triangles
+    cube_vertex_number, cube_triangle_number, cube_vertices<T>, cube_triangles,
+    &cube_bounds<T>, cube_cluster_number, cube_clusters<T>
 };
@@ -0,0 +1,387 @@
+#pragma once
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "MicroRenderer/MicroRenderer.h"
+
+namespace MicroRenderer {
+
+enum BenchmarkScene : uint32
+{
+    SCENE_DEMO,
+    SCENE_SPHERES,
+    NUM_BENCHMARK_SCENES
+};
+
+enum BenchmarkScalarType : uint32
+{
+    SCALAR_FLOAT,
+    SCALAR_DOUBLE,
+    SCALAR_FIXED,
+    NUM_BENCHMARK_SCALAR_TYPES
+};
+
+struct BenchmarkOptions
+{
+    std::string shader = "unlit";
+    BenchmarkScene scene = SCENE_DEMO;
+    RenderMode render_mode = SCANLINE;
+    BenchmarkScalarType scalar_type = SCALAR_FLOAT;
+    int32 width = 1000;
+    int32 height = 1000;
+    uint32 num_frames = 600;
+    uint32 num_warmup_frames = 10;
+    // Synthetic spheres: segments around the equator and number of instances in a grid.
+    uint16 sphere_segments = 64;
+    uint16 num_sphere_instances = 9;
+    uint32 num_threads = 1;
+    // Rasterization buffers, 0 for one per triangle.
+    uint16 num_rasterization_buffers = 0;
+    // Distance of the camera from the origin in percent of the demo's.
+    uint32 camera_distance = 100;
+    // Renderer features, see RendererConfiguration and ShaderConfiguration.
+    bool hierarchical_depth = false;
+    bool deferred_shading = false;
+    bool deferred_setup = false;
+    bool lazy_attributes = false;
+    bool perspective_correction = false;
+    // Compare checksums with the other render modes.
+    bool check_modes = false;
+    std::string format = "csv";
+    // Empty for stdout.
+    std::string output;
+    // Chrome trace of the first timed frames, if not empty. Requires MICRORENDERER_TRACE.
+    std::string trace_output;
+    uint32 num_trace_frames = 10;
+};
+
+struct FrameResult
+{
+    double milliseconds;
+    // FNV-1a hash of the framebuffer, identical between runs of the same options.
+    uint64 checksum;
+    // Render mode 'SCANLINE': passes over the scene's geometry and triangles that did not fit into buffers.
+    uint32 num_slabs;
+    uint32 num_overflows;
+#ifdef MICRORENDERER_STATISTICS
+    RenderStatistics statistics;
+#endif
+};
+
+// Rotation of scene objects per frame in degrees.
+constexpr double benchmark_rotation_per_frame = 0.5;
+
+// Scanlines per bucket in render mode 'SCANLINE'.
+constexpr int16 benchmark_scanlines_per_bucket = 8;
+
+// Capacity of the trace's event buffer, enough for a few thousand scanline bands or tiles per frame.
+constexpr uint32 benchmark_max_num_trace_events = 1 << 18;
+
+// UV sphere around the origin with the given number of segments around the equator and half as many rings. Vertices at
+// the seam are duplicated for texture coordinates, triangles at the poles are left out where they would be degenerate.
+template<typename VertexSource>
+void generateSphere(uint16 segments, double radius, std::vector<VertexSource>& vertices, std::vector<TriangleIndices>& indices)
+{
+    constexpr double pi = 3.14159265358979323846;
+    const uint16 rings = segments / 2;
+    vertices.clear();
+    indices.clear();
+    for (uint16 ring = 0; ring <= rings; ++ring) {
+        const double polar = pi * ring / rings;
+        for (uint16 segment = 0; segment <= segments; ++segment) {
+            const double azimuth = 2.0 * pi * segment / segments;
+            VertexSource vertex{};
+            using Scalar = decltype(vertex.position.x);
+            vertex.position = static_cast<Vector3<Scalar>>(Vector3<double>(
+                radius * std::sin(polar) * std::cos(azimuth), radius * std::cos(polar), radius * std::sin(polar) * std::sin(azimuth)));
+            if constexpr (requires { vertex.uv_coordinates; }) {
+                vertex.uv_coordinates = {static_cast<Scalar>(static_cast<double>(segment) / segments),
+                                         static_cast<Scalar>(static_cast<double>(ring) / rings)};
+            }
+            vertices.push_back(vertex);
+        }
+    }
+    for (uint16 ring = 0; ring < rings; ++ring) {
+        for (uint16 segment = 0; segment < segments; ++segment) {
+            const uint16 top_left = ring * (segments + 1) + segment;
+            const uint16 bottom_left = top_left + segments + 1;
+            if (ring != 0) {
+                indices.push_back({top_left, static_cast<uint16>(top_left + 1), bottom_left});
+            }
+            if (ring != rings - 1) {
+                indices.push_back({static_cast<uint16>(top_left + 1), static_cast<uint16>(bottom_left + 1), bottom_left});
+            }
+        }
+    }
+}
+
+// Renders options.num_frames frames of a scene after warming up. Scene<T> provides the models and instances of the
+// shader program for scalar type T and updates instance transforms for a frame from the screen-projection-view matrix.
+template<typename T, RendererConfiguration t_cfg, template <typename, ShaderConfiguration> class ShaderProgram,
+         template <typename, ShaderConfiguration> class Scene>
+std::vector<FrameResult> runBenchmark(const BenchmarkOptions& options)
+{
+    using BenchmarkRenderer = Renderer<T, t_cfg, ShaderProgram>;
+    const int32 width = options.width;
+    const int32 height = options.height;
+
+    // Renderer and scene live on the heap, since rasterization data of large scenes exceeds the stack.
+    auto renderer = std::make_unique<BenchmarkRenderer>();
+    auto scene = std::make_unique<Scene<T, t_cfg.shader_cfg>>(options);
+    renderer->setResolution(width, height);
+    renderer->setNearPlane(static_cast<T>(0.1));
+    renderer->setModels(scene->getModels());
+    renderer->setInstances(scene->getInstances(), scene->getNumInstances());
+    renderer->setGlobalData(scene->getGlobalData());
+
+    // Buffers. Scenes with more triangles than rasterization buffers are rendered in slabs (render mode 'SCANLINE')
+    // or drop triangles (render mode 'TILED').
+    std::vector<typename BenchmarkRenderer::VertexBuffer> vertex_buffers(scene->getMaxNumVertices());
+    renderer->setVertexBuffers(vertex_buffers.data());
+    const uint32 num_triangles = scene->getNumTriangles();
+    const uint16 num_rasterization_buffers = options.num_rasterization_buffers > 0 ? options.num_rasterization_buffers
+                                             : static_cast<uint16>(std::min<uint32>(num_triangles, 0xFFFF));
+    std::vector<typename BenchmarkRenderer::RasterizationBuffer> rasterization_buffers(num_rasterization_buffers);
+    std::vector<uint8> framebuffer(static_cast<size_t>(width) * height * 3);
+    std::vector<T> depthbuffer;
+    std::vector<typename BenchmarkRenderer::RasterizationOrder> rasterization_order;
+    std::vector<uint16> rasterization_histogram;
+    std::vector<typename BenchmarkRenderer::TriangleRecord> triangle_records;
+    std::vector<uint16> buffer_slots;
+    std::vector<typename BenchmarkRenderer::TileBin> tile_bins;
+    std::vector<typename BenchmarkRenderer::TileBinEntry> tile_bin_entries;
+    if constexpr (t_cfg.render_mode != TILED) {
+        depthbuffer.resize(static_cast<size_t>(width) * height);
+    }
+    if constexpr (t_cfg.deferred_setup == DEFERRED_SETUP_ENABLED) {
+        // One record per triangle, or per half of a triangle clipped into two.
+        triangle_records.resize(std::min<uint32>(2 * num_triangles, 0xFFFF));
+        rasterization_order.resize(triangle_records.size());
+        buffer_slots.resize(num_rasterization_buffers);
+        rasterization_histogram.resize(height + 1);
+        renderer->setTriangleRecords(triangle_records.data(), rasterization_order.data(),
+                                     static_cast<uint16>(triangle_records.size()));
+        renderer->setRasterizationBuffers(rasterization_buffers.data(), buffer_slots.data(), num_rasterization_buffers);
+        renderer->setRasterizationHistogram(rasterization_histogram.data());
+        renderer->setScanlinesPerBucket(benchmark_scanlines_per_bucket);
+    }
+    else if constexpr (t_cfg.render_mode == SCANLINE) {
+        rasterization_order.resize(num_rasterization_buffers);
+        rasterization_histogram.resize(height + 1);
+        renderer->setRasterizationBuffers(rasterization_buffers.data(), rasterization_order.data(), num_rasterization_buffers);
+        renderer->setRasterizationHistogram(rasterization_histogram.data());
+        renderer->setScanlinesPerBucket(benchmark_scanlines_per_bucket);
+    }
+    else if constexpr (t_cfg.render_mode == TILED) {
+        // Small triangles overlap few tiles, large ones are few.
+        tile_bins.resize(renderer->getNumTiles());
+        tile_bin_entries.resize(4 * num_rasterization_buffers + 16 * tile_bins.size());
+        renderer->setRasterizationBuffers(rasterization_buffers.data(), num_rasterization_buffers);
+        renderer->setTileBins(tile_bins.data(), tile_bin_entries.data(), static_cast<uint32>(tile_bin_entries.size()));
+    }
+#ifdef MICRORENDERER_MULTITHREADING
+    std::unique_ptr<TileScheduler> scheduler;
+    if constexpr (t_cfg.render_mode == TILED) {
+        if (options.num_threads > 1) {
+            scheduler = std::make_unique<TileScheduler>(options.num_threads);
+            renderer->setTileScheduler(scheduler.get());
+        }
+    }
+#endif
+#ifdef MICRORENDERER_TRACE
+    RenderTrace trace;
+    std::vector<TraceEvent> trace_events;
+    if (!options.trace_output.empty()) {
+        trace_events.resize(benchmark_max_num_trace_events);
+        trace.setEventBuffer(trace_events.data(), benchmark_max_num_trace_events);
+        trace.setCaptureRange(options.num_warmup_frames, options.num_trace_frames);
+        renderer->setTrace(&trace);
+    }
+#endif
+
+    // Fixed camera of the demo, optionally moved along its view direction.
+    const double camera_distance = options.camera_distance / 100.0;
+    const double aspect_ratio = static_cast<double>(height) / static_cast<double>(width);
+    Matrix4<double> screen_proj_view_tf = Transform::viewport<double>(width, height, false, false);
+    screen_proj_view_tf *= Transform::perspectiveProjection<double>(-0.02, 0.02, -0.02 * aspect_ratio,
+                                                                   0.02 * aspect_ratio, 0.1, 15.);
+    const Matrix3<double> view_rotation = Transform::rotationEuler(Vector3<double>(-20.82, -31.38, 0.)).getMatrix3();
+    screen_proj_view_tf *= Transform::camera<double>(Vector3<double>(4.872785, -3.176531, -7.266366) * camera_distance, view_rotation * Vector3<double>(0., 0., 1.),
+                                                     view_rotation * Vector3<double>(0., 1., 0.));
+
+    std::vector<FrameResult> results;
+    results.reserve(options.num_frames);
+    for (uint32 frame = 0; frame < options.num_warmup_frames + options.num_frames; ++frame) {
+        scene->update(frame, screen_proj_view_tf);
+        const auto start = std::chrono::steady_clock::now();
+
+        // Clear buffers at full resolution.
+        renderer->setFramebuffer(framebuffer.data());
+        renderer->getFramebuffer().setResolution(width, height);
+        renderer->getFramebuffer().clearBuffer({0});
+        if constexpr (t_cfg.render_mode != TILED) {
+            renderer->setDepthbuffer(depthbuffer.data());
+            renderer->getDepthbuffer().setResolution(width, height);
+            renderer->getDepthbuffer().clearBuffer(static_cast<T>(0.0));
+        }
+        renderer->setResolution(width, height);
+
+        // Render, bucket by bucket in render mode 'SCANLINE'.
+        renderer->render();
+        if constexpr (t_cfg.render_mode == SCANLINE) {
+            for (int32 y = 0; y < height; y += benchmark_scanlines_per_bucket) {
+                renderer->setFramebuffer(framebuffer.data() + static_cast<size_t>(y) * width * 3);
+                renderer->setDepthbuffer(depthbuffer.data() + static_cast<size_t>(y) * width);
+                renderer->renderNextScanlineBand();
+            }
+        }
+
+        const auto elapsed = std::chrono::steady_clock::now() - start;
+        if (frame < options.num_warmup_frames) {
+            continue;
+        }
+        FrameResult result;
+        result.milliseconds = std::chrono::duration<double, std::milli>(elapsed).count();
+        result.checksum = 14695981039346656037ull;
+        for (const uint8 byte : framebuffer) {
+            result.checksum = (result.checksum ^ byte) * 1099511628211ull;
+        }
+        result.num_slabs = 1;
+        result.num_overflows = 0;
+        if constexpr (t_cfg.render_mode == SCANLINE) {
+            result.num_slabs = renderer->getNumSlabs();
+            result.num_overflows = renderer->getNumOverflows();
+        }
+#ifdef MICRORENDERER_STATISTICS
+        result.statistics = renderer->getStatistics();
+#endif
+        results.push_back(result);
+    }
+#ifdef MICRORENDERER_TRACE
+    if (!options.trace_output.empty()) {
+        if (!trace.saveToChromeTrace(options.trace_output)) {
+            fprintf(stderr, "Cannot write trace file: %s\n", options.trace_output.c_str());
+        }
+        else if (trace.getNumDroppedEvents() > 0) {
+            fprintf(stderr, "Trace buffer full, %u events dropped.\n", trace.getNumDroppedEvents());
+        }
+    }
+#endif
+    return results;
+}
+
+// Whether the shader program's configuration can enable perspective correction, which requires packed attributes.
+template<template <typename, ShaderConfiguration> class ShaderProgram, ShaderConfiguration shader_cfg>
+constexpr bool benchmark_perspective_correction = requires {
+    decltype(ShaderProgram<float, shader_cfg>::TriangleBuffer::attributes)::num_components;
+};
+
+// Runs a benchmark with the scalar type of the options.
+template<RendererConfiguration t_cfg, template <typename, ShaderConfiguration> class ShaderProgram,
+         template <typename, ShaderConfiguration> class Scene>
+std::vector<FrameResult> dispatchScalarType(const BenchmarkOptions& options)
+{
+    using FixedScalar = RenderScalar<FIXED_POINT, FULL_PRECISION>;
+    constexpr RendererConfiguration fixed_cfg = [] {
+        RendererConfiguration cfg = t_cfg;
+        cfg.data_type = FIXED_POINT;
+        return cfg;
+    }();
+    switch (options.scalar_type) {
+        case SCALAR_DOUBLE:
+            return runBenchmark<double, t_cfg, ShaderProgram, Scene>(options);
+        case SCALAR_FIXED:
+            return runBenchmark<FixedScalar, fixed_cfg, ShaderProgram, Scene>(options);
+        default:
+            return runBenchmark<float, t_cfg, ShaderProgram, Scene>(options);
+    }
+}
+
+// Enables the features of the options one after another, instantiating only configurations the renderer supports.
+// Options are validated before, so that every requested feature is supported.
+template<RendererConfiguration t_cfg, template <typename, ShaderConfiguration> class ShaderProgram,
+         template <typename, ShaderConfiguration> class Scene>
+std::vector<FrameResult> dispatchFeatures(const BenchmarkOptions& options)
+{
+    if constexpr (t_cfg.render_mode != SCANLINE && t_cfg.hierarchical_depth == HIERARCHICAL_DEPTH_DISABLED) {
+        if (options.hierarchical_depth) {
+            constexpr RendererConfiguration cfg = [] {
+                RendererConfiguration cfg = t_cfg;
+                cfg.hierarchical_depth = HIERARCHICAL_DEPTH_ENABLED;
+                return cfg;
+            }();
+            return dispatchFeatures<cfg, ShaderProgram, Scene>(options);
+        }
+    }
+    if constexpr (t_cfg.render_mode == TILED && t_cfg.deferred_shading == DEFERRED_SHADING_DISABLED &&
+                  t_cfg.lazy_attributes == LAZY_ATTRIBUTES_DISABLED &&
+                  t_cfg.shader_cfg.perspective_correction == PERSPECTIVE_CORRECTION_DISABLED) {
+        if (options.deferred_shading) {
+            constexpr RendererConfiguration cfg = [] {
+                RendererConfiguration cfg = t_cfg;
+                cfg.deferred_shading = DEFERRED_SHADING_ENABLED;
+                return cfg;
+            }();
+            return dispatchFeatures<cfg, ShaderProgram, Scene>(options);
+        }
+    }
+    if constexpr (t_cfg.render_mode == SCANLINE && t_cfg.deferred_setup == DEFERRED_SETUP_DISABLED) {
+        if (options.deferred_setup) {
+            constexpr RendererConfiguration cfg = [] {
+                RendererConfiguration cfg = t_cfg;
+                cfg.deferred_setup = DEFERRED_SETUP_ENABLED;
+                return cfg;
+            }();
+            return dispatchFeatures<cfg, ShaderProgram, Scene>(options);
+        }
+    }
+    if constexpr (t_cfg.deferred_shading == DEFERRED_SHADING_DISABLED && t_cfg.lazy_attributes == LAZY_ATTRIBUTES_DISABLED) {
+        if (options.lazy_attributes) {
+            constexpr RendererConfiguration cfg = [] {
+                RendererConfiguration cfg = t_cfg;
+                cfg.lazy_attributes = LAZY_ATTRIBUTES_ENABLED;
+                return cfg;
+            }();
+            return dispatchFeatures<cfg, ShaderProgram, Scene>(options);
+        }
+    }
+    if constexpr (t_cfg.deferred_shading == DEFERRED_SHADING_DISABLED &&
+                  t_cfg.shader_cfg.perspective_correction == PERSPECTIVE_CORRECTION_DISABLED &&
+                  benchmark_perspective_correction<ShaderProgram, t_cfg.shader_cfg>) {
+        if (options.perspective_correction) {
+            constexpr RendererConfiguration cfg = [] {
+                RendererConfiguration cfg = t_cfg;
+                cfg.shader_cfg.perspective_correction = PERSPECTIVE_CORRECTION_ENABLED;
+                return cfg;
+            }();
+            return dispatchFeatures<cfg, ShaderProgram, Scene>(options);
+        }
+    }
+    return dispatchScalarType<t_cfg, ShaderProgram, Scene>(options);
+}
+
+// Runs a benchmark with the render mode, features and scalar type of the options.
+template<ShaderConfiguration shader_cfg, template <typename, ShaderConfiguration> class ShaderProgram,
+         template <typename, ShaderConfiguration> class Scene>
+std::vector<FrameResult> dispatchBenchmark(const BenchmarkOptions& options)
+{
+    switch (options.render_mode) {
+        case FRAMEBUFFER:
+            return dispatchFeatures<RendererConfiguration{FRAMEBUFFER, CLOCKWISE, shader_cfg}, ShaderProgram, Scene>(options);
+        case TILED:
+            return dispatchFeatures<RendererConfiguration{TILED, CLOCKWISE, shader_cfg}, ShaderProgram, Scene>(options);
+        default:
+            return dispatchFeatures<RendererConfiguration{SCANLINE, CLOCKWISE, shader_cfg}, ShaderProgram, Scene>(options);
+    }
+}
+
+// Entry points of the scene translation units, one per shader since model headers of different shaders share names.
+std::vector<FrameResult> runUnlitTexturedBenchmark(const BenchmarkOptions& options);
+
+std::vector<FrameResult> runSimpleContoursBenchmark(const BenchmarkOptions& options);
+
+} // namespace MicroRenderer
@@ -0,0 +1,324 @@
+/*
+ * Headless benchmark, renders scripted scenes without a display and writes per-frame timings as CSV or JSON.
+ *
+ * Options:
+ * --shader unlit|contours              UnlitTextured or SimpleContours shader (default: unlit).
+ * --scene demo|spheres                 Scene of the demo or a grid of synthetic UV spheres (default: demo).
+ * --segments N                         Segments around the equator of each sphere, N * (N - 2) triangles (default: 64).
+ * --instances N                        Number of spheres (default: 9).
+ * --mode framebuffer|scanline|tiled    Render mode (default: scanline).
+ * --type float|double|fixed            Scalar type, fixed is Q32.32 (default: float).
+ * --width N, --height N                Resolution (default: 1000 x 1000).
+ * --frames N                           Number of timed frames (default: 600).
+ * --warmup N                           Number of untimed frames before (default: 10).
+ * --threads N                          Threads shading tiles in render mode 'TILED' (default: 1).
+ * --buffers N                          Rasterization buffers, fewer than triangles render in slabs in render mode
+ *                                      'SCANLINE' (default: one per triangle).
+ * --camera-distance N                  Camera distance in percent of the demo's, closer clips at the near plane
+ *                                      (default: 100).
+ * --hierarchical-depth on|off          Hierarchical depth, not in render mode 'SCANLINE' (default: off).
+ * --deferred-shading on|off            Deferred shading, only in render mode 'TILED' (default: off).
+ * --deferred-setup on|off              Deferred triangle setup, only in render mode 'SCANLINE' (default: off).
+ * --lazy-attributes on|off             Lazy attribute evaluation, not with deferred shading (default: off).
+ * --perspective-correction on|off      Perspective-correct attributes, only with the unlit shader and not with deferred
+ *                                      shading (default: off).
+ * --check-modes on|off                 Also renders in the other render modes, with the features they support, and
+ *                                      exits with 1 if any frame's checksum differs (default: off).
+ * --format csv|json                    Output format (default: csv).
+ * --output FILE                        Output file (default: stdout).
+ * --trace FILE                         Chrome trace of the first timed frames, requires MICRORENDERER_TRACE.
+ * --trace-frames N                     Number of traced frames (default: 10).
+ *
+ * A frame is timed from clearing the buffers to its last scanline. Objects rotate by a fixed angle per frame, so that
+ * runs are reproducible. The checksum of each frame's framebuffer allows comparing output between builds. Render modes
+ * only match exactly with double or fixed, since float rounds attributes differently at tile borders.
+ */
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+#include "HeadlessBenchmark.h"
+
+using namespace MicroRenderer;
+
+namespace {
+
+[[noreturn]] void exitWithUsage(const char* message, const char* argument)
+{
+    fprintf(stderr, "%s: %s\nSee the top of benchmark/headless_benchmark.cpp for options.\n", message, argument);
+    exit(1);
+}
+
+uint32 parseNumber(const char* option, const char* value, uint32 min, uint32 max)
+{
+    char* end = nullptr;
+    const unsigned long number = strtoul(value, &end, 10);
+    if (*end != '\0' || number < min || number > max) {
+        exitWithUsage("Invalid value of option", option);
+    }
+    return static_cast<uint32>(number);
+}
+
+bool parseSwitch(const char* option, const char* value)
+{
+    if (strcmp(value, "on") != 0 && strcmp(value, "off") != 0) {
+        exitWithUsage("Invalid value of option", option);
+    }
+    return strcmp(value, "on") == 0;
+}
+
+// Disables the features not supported by the options' render mode.
+BenchmarkOptions getSupportedOptions(BenchmarkOptions options)
+{
+    options.hierarchical_depth &= options.render_mode != SCANLINE;
+    options.deferred_shading &= options.render_mode == TILED;
+    options.deferred_setup &= options.render_mode == SCANLINE;
+    return options;
+}
+
+BenchmarkOptions parseOptions(int argc, char* argv[])
+{
+    BenchmarkOptions options;
+    for (int i = 1; i < argc; i += 2) {
+        const char* option = argv[i];
+        if (i + 1 >= argc) {
+            exitWithUsage("Missing value of option", option);
+        }
+        const char* value = argv[i + 1];
+        if (strcmp(option, "--shader") == 0) {
+            if (strcmp(value, "unlit") != 0 && strcmp(value, "contours") != 0) {
+                exitWithUsage("Unknown shader", value);
+            }
+            options.shader = value;
+        }
+        else if (strcmp(option, "--scene") == 0) {
+            options.scene = strcmp(value, "demo") == 0 ? SCENE_DEMO : strcmp(value, "spheres") == 0 ? SCENE_SPHERES
+                                                                                                     : NUM_BENCHMARK_SCENES;
+            if (options.scene == NUM_BENCHMARK_SCENES) {
+                exitWithUsage("Unknown scene", value);
+            }
+        }
+        else if (strcmp(option, "--segments") == 0) {
+            // Vertex and triangle indices are 16 bit.
+            options.sphere_segments = static_cast<uint16>(parseNumber(option, value, 4, 256) & ~1u);
+        }
+        else if (strcmp(option, "--instances") == 0) {
+            options.num_sphere_instances = static_cast<uint16>(parseNumber(option, value, 1, 1024));
+        }
+        else if (strcmp(option, "--mode") == 0) {
+            options.render_mode = strcmp(value, "framebuffer") == 0 ? FRAMEBUFFER : strcmp(value, "scanline") == 0 ? SCANLINE
+                                  : strcmp(value, "tiled") == 0 ? TILED : NUM_RENDER_MODES;
+            if (options.render_mode == NUM_RENDER_MODES) {
+                exitWithUsage("Unknown render mode", value);
+            }
+        }
+        else if (strcmp(option, "--type") == 0) {
+            options.scalar_type = strcmp(value, "float") == 0 ? SCALAR_FLOAT : strcmp(value, "double") == 0 ? SCALAR_DOUBLE
+                                  : strcmp(value, "fixed") == 0 ? SCALAR_FIXED : NUM_BENCHMARK_SCALAR_TYPES;
+            if (options.scalar_type == NUM_BENCHMARK_SCALAR_TYPES) {
+                exitWithUsage("Unknown scalar type", value);
+            }
+        }
+        else if (strcmp(option, "--width") == 0) {
+            options.width = static_cast<int32>(parseNumber(option, value, 1, 8192));
+        }
+        else if (strcmp(option, "--height") == 0) {
+            options.height = static_cast<int32>(parseNumber(option, value, 1, 8192));
+        }
+        else if (strcmp(option, "--frames") == 0) {
+            options.num_frames = parseNumber(option, value, 1, 1000000);
+        }
+        else if (strcmp(option, "--warmup") == 0) {
+            options.num_warmup_frames = parseNumber(option, value, 0, 1000000);
+        }
+        else if (strcmp(option, "--threads") == 0) {
+            options.num_threads = parseNumber(option, value, 1, 64);
+#ifndef MICRORENDERER_MULTITHREADING
+            if (options.num_threads > 1) {
+                exitWithUsage("Multiple threads require MICRORENDERER_MULTITHREADING", option);
+            }
+#endif
+        }
+        else if (strcmp(option, "--buffers") == 0) {
+            options.num_rasterization_buffers = static_cast<uint16>(parseNumber(option, value, 1, 0xFFFF));
+        }
+        else if (strcmp(option, "--camera-distance") == 0) {
+            options.camera_distance = parseNumber(option, value, 1, 1000);
+        }
+        else if (strcmp(option, "--hierarchical-depth") == 0) {
+            options.hierarchical_depth = parseSwitch(option, value);
+        }
+        else if (strcmp(option, "--deferred-shading") == 0) {
+            options.deferred_shading = parseSwitch(option, value);
+        }
+        else if (strcmp(option, "--deferred-setup") == 0) {
+            options.deferred_setup = parseSwitch(option, value);
+        }
+        else if (strcmp(option, "--lazy-attributes") == 0) {
+            options.lazy_attributes = parseSwitch(option, value);
+        }
+        else if (strcmp(option, "--perspective-correction") == 0) {
+            options.perspective_correction = parseSwitch(option, value);
+        }
+        else if (strcmp(option, "--check-modes") == 0) {
+            options.check_modes = parseSwitch(option, value);
+        }
+        else if (strcmp(option, "--format") == 0) {
+            if (strcmp(value, "csv") != 0 && strcmp(value, "json") != 0) {
+                exitWithUsage("Unknown output format", value);
+            }
+            options.format = value;
+        }
+        else if (strcmp(option, "--output") == 0) {
+            options.output = value;
+        }
+        else if (strcmp(option, "--trace") == 0) {
+#ifndef MICRORENDERER_TRACE
+            exitWithUsage("Tracing requires MICRORENDERER_TRACE", option);
+#endif
+            options.trace_output = value;
+        }
+        else if (strcmp(option, "--trace-frames") == 0) {
+            options.num_trace_frames = parseNumber(option, value, 1, 1000000);
+        }
+        else {
+            exitWithUsage("Unknown option", option);
+        }
+    }
+
+    // Combinations of features the renderer does not support.
+    const BenchmarkOptions supported_options = getSupportedOptions(options);
+    if (supported_options.hierarchical_depth != options.hierarchical_depth) {
+        exitWithUsage("Hierarchical depth is not supported in render mode", "scanline");
+    }
+    if (supported_options.deferred_shading != options.deferred_shading) {
+        exitWithUsage("Deferred shading requires render mode", "tiled");
+    }
+    if (supported_options.deferred_setup != options.deferred_setup) {
+        exitWithUsage("Deferred setup requires render mode", "scanline");
+    }
+    if (options.deferred_shading && (options.lazy_attributes || options.perspective_correction)) {
+        exitWithUsage("Deferred shading does not support", options.lazy_attributes ? "--lazy-attributes" : "--perspective-correction");
+    }
+    if (options.perspective_correction && options.shader != "unlit") {
+        exitWithUsage("Perspective correction is not supported by shader", options.shader.c_str());
+    }
+    return options;
+}
+
+std::vector<FrameResult> runShaderBenchmark(const BenchmarkOptions& options)
+{
+    return options.shader == "contours" ? runSimpleContoursBenchmark(options) : runUnlitTexturedBenchmark(options);
+}
+
+const char* getRenderModeName(RenderMode render_mode)
+{
+    return render_mode == FRAMEBUFFER ? "framebuffer" : render_mode == SCANLINE ? "scanline" : "tiled";
+}
+
+const char* getScalarTypeName(BenchmarkScalarType scalar_type)
+{
+    return scalar_type == SCALAR_FLOAT ? "float" : scalar_type == SCALAR_DOUBLE ? "double" : "fixed";
+}
+
+void writeCSV(FILE* file, const std::vector<FrameResult>& results)
+{
+    fprintf(file, "frame,milliseconds,checksum,slabs,overflows");
+#ifdef MICRORENDERER_STATISTICS
+    fprintf(file, ",triangles_set_up,triangles_dropped,fragments_generated,depth_tests_passed,colors_computed");
+#endif
+    fprintf(file, "\n");
+    for (size_t frame = 0; frame < results.size(); ++frame) {
+        const FrameResult& result = results[frame];
+        fprintf(file, "%zu,%.6f,%016llx,%u,%u", frame, result.milliseconds, static_cast<unsigned long long>(result.checksum),
+                result.num_slabs, result.num_overflows);
+#ifdef MICRORENDERER_STATISTICS
+        fprintf(file, ",%u,%u,%u,%u,%u", result.statistics.triangles_set_up, result.statistics.triangles_dropped,
+                result.statistics.fragments_generated, result.statistics.depth_tests_passed,
+                result.statistics.colors_computed);
+#endif
+        fprintf(file, "\n");
+    }
+}
+
+void writeJSON(FILE* file, const BenchmarkOptions& options, const std::vector<FrameResult>& results)
+{
+    fprintf(file, "{\n  \"shader\": \"%s\",\n  \"scene\": \"%s\",\n", options.shader.c_str(),
+            options.scene == SCENE_DEMO ? "demo" : "spheres");
+    if (options.scene == SCENE_SPHERES) {
+        fprintf(file, "  \"segments\": %u,\n  \"instances\": %u,\n", options.sphere_segments, options.num_sphere_instances);
+    }
+    fprintf(file, "  \"mode\": \"%s\",\n  \"type\": \"%s\",\n  \"width\": %d,\n  \"height\": %d,\n  \"threads\": %u,\n",
+            getRenderModeName(options.render_mode), getScalarTypeName(options.scalar_type), options.width,
+            options.height, options.num_threads);
+    fprintf(file, "  \"buffers\": %u,\n  \"camera_distance\": %u,\n", options.num_rasterization_buffers,
+            options.camera_distance);
+    fprintf(file, "  \"hierarchical_depth\": %s,\n  \"deferred_shading\": %s,\n  \"deferred_setup\": %s,\n",
+            options.hierarchical_depth ? "true" : "false", options.deferred_shading ? "true" : "false",
+            options.deferred_setup ? "true" : "false");
+    fprintf(file, "  \"lazy_attributes\": %s,\n  \"perspective_correction\": %s,\n",
+            options.lazy_attributes ? "true" : "false", options.perspective_correction ? "true" : "false");
+    fprintf(file, "  \"frames\": [\n");
+    for (size_t frame = 0; frame < results.size(); ++frame) {
+        const FrameResult& result = results[frame];
+        fprintf(file, "    {\"milliseconds\": %.6f, \"checksum\": \"%016llx\", \"slabs\": %u, \"overflows\": %u",
+                result.milliseconds, static_cast<unsigned long long>(result.checksum), result.num_slabs,
+                result.num_overflows);
+#ifdef MICRORENDERER_STATISTICS
+        fprintf(file, ", \"triangles_set_up\": %u, \"triangles_dropped\": %u, \"fragments_generated\": %u, "
+                "\"depth_tests_passed\": %u, \"colors_computed\": %u", result.statistics.triangles_set_up,
+                result.statistics.triangles_dropped, result.statistics.fragments_generated,
+                result.statistics.depth_tests_passed, result.statistics.colors_computed);
+#endif
+        fprintf(file, "}%s\n", frame + 1 < results.size() ? "," : "");
+    }
+    fprintf(file, "  ]\n}\n");
+}
+
+} // namespace
+
+int main(int argc, char* argv[])
+{
+    const BenchmarkOptions options = parseOptions(argc, argv);
+    const std::vector<FrameResult> results = runShaderBenchmark(options);
+
+    // Compare checksums with the other render modes.
+    bool modes_match = true;
+    if (options.check_modes) {
+        for (const RenderMode render_mode : {FRAMEBUFFER, SCANLINE, TILED}) {
+            if (render_mode == options.render_mode) {
+                continue;
+            }
+            BenchmarkOptions mode_options = options;
+            mode_options.render_mode = render_mode;
+            mode_options.trace_output.clear();
+            const std::vector<FrameResult> mode_results = runShaderBenchmark(getSupportedOptions(mode_options));
+            uint32 num_differing_frames = 0;
+            for (size_t frame = 0; frame < results.size(); ++frame) {
+                num_differing_frames += mode_results[frame].checksum != results[frame].checksum;
+            }
+            if (num_differing_frames > 0) {
+                fprintf(stderr, "Checksums of render mode '%s' differ from '%s' in %u of %zu frames.\n",
+                        getRenderModeName(render_mode), getRenderModeName(options.render_mode), num_differing_frames,
+                        results.size());
+                modes_match = false;
+            }
+        }
+    }
+
+    FILE* file = options.output.empty() ? stdout : fopen(options.output.c_str(), "w");
+    if (file == nullptr) {
+        exitWithUsage("Cannot open output file", options.output.c_str());
+    }
+    if (options.format == "json") {
+        writeJSON(file, options, results);
+    }
+    else {
+        writeCSV(file, results);
+    }
+    if (file != stdout) {
+        fclose(file);
+    }
+    return modes_match ? 0 : 1;
+}
@@ -0,0 +1,433 @@
+/*
+ * Micro-benchmarks of the hot kernels, each timed in isolation for float, double and fixed-point (Q32.32) scalars.
+ * Writes one CSV line per kernel and scalar type with nanoseconds per operation and the resulting throughput.
+ *
+ * Options:
+ * --filter TEXT        Only run kernels whose name contains TEXT.
+ * --min-time N         Minimum timed milliseconds per kernel (default: 100).
+ */
+
+#define MICRORENDERER_KERNEL_BENCHMARK
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "MicroRenderer/MicroRenderer.h"
+#include "UnlitTextured/UnlitTexturedShaderProgram.h"
+#include "textures/RGB888/color_grid_texture.h"
+
+namespace MicroRenderer {
+
+// Forwards to the private kernels of a renderer.
+struct RendererKernels
+{
+    template<typename RendererType>
+    static void processVertices(RendererType& renderer, const typename RendererType::ModelData* model)
+    {
+        renderer.processVertices(model);
+    }
+
+    template<typename RendererType>
+    static bool setupTriangleRasterization(RendererType& renderer, const typename RendererType::VertexData& v1,
+                                           const typename RendererType::VertexData& v2,
+                                           const typename RendererType::VertexData& v3,
+                                           typename RendererType::RasterizationBuffer& rasterization, int32& start_scanline)
+    {
+        return renderer.setupTriangleRasterization(0, v1, v2, v3, rasterization, start_scanline);
+    }
+
+    template<typename RendererType>
+    static void shadeScanlineOfTriangle(RendererType& renderer, typename RendererType::RasterizationBuffer& rasterization,
+                                        int32 scanline)
+    {
+        renderer.shadeScanlineOfTriangle(rasterization, scanline);
+    }
+};
+
+} // namespace MicroRenderer
+
+using namespace MicroRenderer;
+
+namespace {
+
+// Operations per timed batch of the kernels that loop over an input array.
+constexpr uint32 batch_size = 1024;
+
+// Resolution of textures and of the framebuffer that triangles are shaded into.
+constexpr int32 texture_size = 256;
+
+const char* kernel_filter = "";
+
+double min_milliseconds = 100.0;
+
+// Keeps the compiler from optimizing away a kernel's result.
+template<typename V>
+void doNotOptimize(const V& value)
+{
+#if defined(__GNUC__)
+    asm volatile("" : : "r,m"(value));
+#else
+    static const void* volatile sink;
+    sink = &value;
+    std::atomic_signal_fence(std::memory_order_seq_cst);
+#endif
+}
+
+template<typename T>
+const char* getScalarName()
+{
+    if constexpr (std::is_same_v<T, float>) {
+        return "float";
+    }
+    else if constexpr (std::is_same_v<T, double>) {
+        return "double";
+    }
+    else {
+        return "fixed";
+    }
+}
+
+// Repeats prepare() and a timed run() of ops_per_run operations until the minimum time is reached, then writes
+// nanoseconds per operation and items (e.g. pixels) per second, given the items processed by one operation.
+template<typename Prepare, typename Run>
+void measure(const char* kernel, const char* type, uint32 ops_per_run, double items_per_op, const char* item_name,
+             Prepare&& prepare, Run&& run)
+{
+    if (strstr(kernel, kernel_filter) == nullptr) {
+        return;
+    }
+    prepare();
+    run(); // Warmup.
+    double nanoseconds = 0.0;
+    uint64 ops = 0;
+    while (nanoseconds < min_milliseconds * 1e6) {
+        prepare();
+        const auto start = std::chrono::steady_clock::now();
+        run();
+        nanoseconds += std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+        ops += ops_per_run;
+    }
+    const double ns_per_op = nanoseconds / static_cast<double>(ops);
+    printf("%s,%s,%.3f,%.0f,%s/s\n", kernel, type, ns_per_op, items_per_op * 1e9 / ns_per_op, item_name);
+}
+
+template<typename Run>
+void measure(const char* kernel, const char* type, uint32 ops_per_run, double items_per_op, const char* item_name, Run&& run)
+{
+    measure(kernel, type, ops_per_run, items_per_op, item_name, [] {}, run);
+}
+
+template<typename T>
+T randomScalar(std::mt19937& generator, double min, double max)
+{
+    return static_cast<T>(std::uniform_real_distribution<double>(min, max)(generator));
+}
+
+template<typename T>
+void benchmarkMath()
+{
+    std::mt19937 generator(42);
+    const char* type = getScalarName<T>();
+
+    // Model-screen transform of the headless benchmark's demo camera, so that results stay in the fixed-point range.
+    Matrix4<double> tf = Transform::viewport<double>(texture_size, texture_size, false, false);
+    tf *= Transform::perspectiveProjection<double>(-0.02, 0.02, -0.02, 0.02, 0.1, 15.);
+    tf *= Transform::translation<double>({0., 0., 4.});
+    const auto model_screen_tf = static_cast<Matrix4<T>>(tf);
+    std::vector<Vector3<T>> positions(batch_size);
+    for (Vector3<T>& position : positions) {
+        position = {randomScalar<T>(generator, -1.0, 1.0), randomScalar<T>(generator, -1.0, 1.0),
+                    randomScalar<T>(generator, -1.0, 1.0)};
+    }
+    measure("transformPosition", type, batch_size, 1.0, "vertices", [&] {
+        for (const Vector3<T>& position : positions) {
+            const Vector4<T> result = model_screen_tf.transformPosition(position);
+            doNotOptimize(result);
+        }
+    });
+
+    // Same positions in structure-of-arrays batches, as shaded by batched vertex shaders.
+    std::vector<Vector3Batch<T, vertex_batch_size>> position_batches(batch_size / vertex_batch_size);
+    for (uint32 vertex_idx = 0; vertex_idx < position_batches.size() * vertex_batch_size; ++vertex_idx) {
+        position_batches[vertex_idx / vertex_batch_size].set(vertex_idx % vertex_batch_size, positions[vertex_idx]);
+    }
+    measure("transformPositions", type, static_cast<uint32>(position_batches.size() * vertex_batch_size), 1.0, "vertices", [&] {
+        for (const Vector3Batch<T, vertex_batch_size>& position_batch : position_batches) {
+            Vector4Batch<T, vertex_batch_size> result;
+            model_screen_tf.transformPositions(position_batch, result);
+            doNotOptimize(result);
+        }
+    });
+
+    // Model-screen transforms of instances, as set up per frame.
+    std::vector<Matrix4<T>> model_tfs(batch_size);
+    for (Matrix4<T>& model_tf : model_tfs) {
+        for (T& component : model_tf.components) {
+            component = randomScalar<T>(generator, -1.0, 1.0);
+        }
+    }
+    measure("Matrix4::operator*", type, batch_size, 1.0, "matrices", [&] {
+        for (const Matrix4<T>& model_tf : model_tfs) {
+            const Matrix4<T> result = model_screen_tf * model_tf;
+            doNotOptimize(result);
+        }
+    });
+    measure("Matrix4::getTranspose", type, batch_size, 1.0, "matrices", [&] {
+        for (const Matrix4<T>& model_tf : model_tfs) {
+            const Matrix4<T> result = model_tf.getTranspose();
+            doNotOptimize(result);
+        }
+    });
+
+    // Screen-space triangles with edges of up to 64 pixels.
+    std::vector<Vector2<T>> corners(3 * batch_size);
+    for (uint32 tri_idx = 0; tri_idx < batch_size; ++tri_idx) {
+        const double x = std::uniform_real_distribution<double>(0.0, 960.0)(generator);
+        const double y = std::uniform_real_distribution<double>(0.0, 960.0)(generator);
+        corners[3 * tri_idx] = {static_cast<T>(x), static_cast<T>(y)};
+        corners[3 * tri_idx + 1] = {static_cast<T>(x + 64.0), randomScalar<T>(generator, y, y + 64.0)};
+        corners[3 * tri_idx + 2] = {randomScalar<T>(generator, x, x + 64.0), static_cast<T>(y + 64.0)};
+    }
+    measure("computeBarycentricIncrements", type, batch_size, 1.0, "triangles", [&] {
+        for (uint32 tri_idx = 0; tri_idx < batch_size; ++tri_idx) {
+            MicroRenderer::BarycentricIncrements<T> bc_incs;
+            computeBarycentricIncrements(corners[3 * tri_idx], corners[3 * tri_idx + 1], corners[3 * tri_idx + 2], bc_incs);
+            doNotOptimize(bc_incs);
+        }
+    });
+
+    // Depth and uv coordinates, stepping along a scanline as the renderer does.
+    MicroRenderer::BarycentricIncrements<T> bc_incs;
+    computeBarycentricIncrements(corners[0], corners[1], corners[2], bc_incs);
+    TriangleAttribute<T, T> depth;
+    TriangleAttribute<T, Vector2<T>> uv;
+    measure("TriangleAttribute::increment<depth>", type, batch_size, 1.0, "pixels", [&] {
+        depth.initialize(static_cast<T>(0.5), static_cast<T>(0.6), static_cast<T>(0.7), bc_incs, Vector2<T>(static_cast<T>(0.0)));
+        for (uint32 x = 0; x < batch_size; ++x) {
+            depth.template increment<IncrementationMode::OneInX>();
+            doNotOptimize(depth);
+        }
+    });
+    measure("TriangleAttribute::increment<uv>", type, batch_size, 1.0, "pixels", [&] {
+        uv.initialize({static_cast<T>(0.0), static_cast<T>(0.0)}, {static_cast<T>(1.0), static_cast<T>(0.0)},
+                      {static_cast<T>(0.0), static_cast<T>(1.0)}, bc_incs, Vector2<T>(static_cast<T>(0.0)));
+        for (uint32 x = 0; x < batch_size; ++x) {
+            uv.template increment<IncrementationMode::OneInX>();
+            doNotOptimize(uv);
+        }
+    });
+}
+
+// Reads, draws and clears a texture of the given format pixel by pixel, walking buffer positions as the renderer does.
+// Decimal external values make conversions depend on the scalar type.
+template<typename T, TextureInternalFormat format>
+void benchmarkTexture(const char* format_name)
+{
+    constexpr TextureConfiguration cfg = {ACCESS_READWRITE, format, SWIZZLE_NONE, TYPE_DECIMAL, WRAPMODE_NONE};
+    using TextureType = Texture2D<T, cfg>;
+    const char* type = getScalarName<T>();
+    std::vector<uint64> memory(texture_size * texture_size);
+    TextureType texture(memory.data(), texture_size, texture_size);
+    using ExternalType = typename TextureType::ExternalType;
+
+    // Values vary along a row, so that drawing them cannot be turned into a fill.
+    std::vector<ExternalType> row_values(texture_size);
+    for (int32 x = 0; x < texture_size; ++x) {
+        row_values[x] = ExternalType(static_cast<T>(x % 16));
+    }
+    const ExternalType& value = row_values[7];
+    texture.clearBuffer(value);
+    constexpr uint32 num_pixels = texture_size * texture_size;
+
+    const std::string read_name = std::string("Texture2D::readPixelAt<") + format_name + ">";
+    measure(read_name.c_str(), type, num_pixels, 1.0, "pixels", [&] {
+        for (int32 y = 0; y < texture_size; ++y) {
+            auto position = texture.pixelNumToBufferPosition(y * texture_size);
+            for (int32 x = 0; x < texture_size; ++x) {
+                const auto pixel = texture.readPixelAt(position);
+                doNotOptimize(pixel);
+                texture.moveBufferPositionRight(position);
+            }
+        }
+    });
+
+    const std::string draw_name = std::string("Texture2D::drawPixelAt<") + format_name + ">";
+    measure(draw_name.c_str(), type, num_pixels, 1.0, "pixels", [&] {
+        for (int32 y = 0; y < texture_size; ++y) {
+            auto position = texture.pixelNumToBufferPosition(y * texture_size);
+            for (int32 x = 0; x < texture_size; ++x) {
+                texture.drawPixelAt(position, row_values[x]);
+                texture.moveBufferPositionRight(position);
+            }
+        }
+        doNotOptimize(memory[0]);
+    });
+
+    const std::string clear_name = std::string("Texture2D::clearBuffer<") + format_name + ">";
+    measure(clear_name.c_str(), type, 1, num_pixels, "pixels", [&] {
+        texture.clearBuffer(value);
+        doNotOptimize(memory[0]);
+    });
+}
+
+template<typename T>
+void benchmarkTextures()
+{
+    benchmarkTexture<T, FORMAT_RGB888>("RGB888");
+    benchmarkTexture<T, FORMAT_RGB565>("RGB565");
+    benchmarkTexture<T, FORMAT_RGB444>("RGB444");
+    benchmarkTexture<T, FORMAT_RGBA4444>("RGBA4444");
+    benchmarkTexture<T, FORMAT_R8>("R8");
+    benchmarkTexture<T, FORMAT_R16>("R16");
+    benchmarkTexture<T, FORMAT_R32>("R32");
+    benchmarkTexture<T, FORMAT_DEPTH>("DEPTH");
+}
+
+// Sets up and shades textured, depth tested triangles with the renderer of the headless benchmark's unlit scene.
+template<typename T, RenderDataType data_type>
+void benchmarkRasterization()
+{
+    constexpr ShaderConfiguration shader_cfg = {
+        PERSPECTIVE, CULL_AT_SCREEN_BORDER, CLIP_AT_NEAR_PLANE, DEPTH_TEST_ENABLED, SHADING_ENABLED,
+        {FORMAT_RGB888, SWIZZLE_NONE, TYPE_INTEGER}
+    };
+    constexpr RendererConfiguration cfg = {FRAMEBUFFER, CLOCKWISE, shader_cfg, data_type};
+    using RendererType = Renderer<T, cfg, UnlitTexturedShaderProgram>;
+    using VertexSource = typename RendererType::VertexSource;
+    using VertexBuffer = typename RendererType::VertexBuffer;
+    using VertexData = typename RendererType::VertexData;
+    using InstanceData = typename RendererType::InstanceData;
+    using ModelData = typename RendererType::ModelData;
+    const char* type = getScalarName<T>();
+
+    auto renderer = std::make_unique<RendererType>();
+    std::vector<uint8> framebuffer(texture_size * texture_size * 3);
+    std::vector<T> depthbuffer(texture_size * texture_size);
+    renderer->setResolution(texture_size, texture_size);
+    renderer->setFramebuffer(framebuffer.data());
+    renderer->setDepthbuffer(depthbuffer.data());
+    renderer->setNearPlane(static_cast<T>(0.1));
+    const InstanceData instance = {0, {1.0}, {color_grid_texture, color_grid_texture_width, color_grid_texture_height}};
+    renderer->getShaderProgram().setInstanceData(&instance);
+
+    // Triangles with edges of up to 32 pixels, in clockwise order. Vertex buffers hold what vertex shading and
+    // homogenization would leave in them.
+    std::mt19937 generator(42);
+    std::vector<VertexSource> sources(3 * batch_size);
+    std::vector<VertexBuffer> buffers(3 * batch_size);
+    for (uint32 tri_idx = 0; tri_idx < batch_size; ++tri_idx) {
+        const double x = std::uniform_real_distribution<double>(0.0, texture_size - 33.0)(generator);
+        const double y = std::uniform_real_distribution<double>(0.0, texture_size - 33.0)(generator);
+        const Vector2<double> corners[3] = {{x, y}, {x + std::uniform_real_distribution<double>(0.0, 32.0)(generator), y + 32.0},
+                                            {x + 32.0, y + std::uniform_real_distribution<double>(0.0, 32.0)(generator)}};
+        for (uint32 corner = 0; corner < 3; ++corner) {
+            sources[3 * tri_idx + corner].uv_coordinates = {static_cast<T>(corners[corner].x / texture_size),
+                                                            static_cast<T>(corners[corner].y / texture_size)};
+            buffers[3 * tri_idx + corner].clip_position = {static_cast<T>(corners[corner].x), static_cast<T>(corners[corner].y),
+                                                           static_cast<T>(0.5), static_cast<T>(1.0)};
+            buffers[3 * tri_idx + corner].screen_position = {static_cast<T>(corners[corner].x), static_cast<T>(corners[corner].y),
+                                                             static_cast<T>(0.5)};
+        }
+    }
+    auto getVertex = [&](uint32 idx) -> VertexData {
+        return {&sources[idx], &buffers[idx]};
+    };
+
+    // Shading and homogenization of a model's vertices, in batches if the vertex shader supports it.
+    std::vector<VertexSource> model_sources(batch_size);
+    std::vector<VertexBuffer> model_buffers(batch_size);
+    for (VertexSource& source : model_sources) {
+        source.position = {randomScalar<T>(generator, -1.0, 1.0), randomScalar<T>(generator, -1.0, 1.0),
+                           randomScalar<T>(generator, -1.0, 1.0)};
+    }
+    const ModelData model = {static_cast<uint16>(batch_size), 0, model_sources.data(), nullptr};
+    renderer->setVertexBuffers(model_buffers.data());
+    measure("processVertices", type, batch_size, 1.0, "vertices", [&] {
+        RendererKernels::processVertices(*renderer, &model);
+        doNotOptimize(model_buffers.back());
+    });
+
+    typename RendererType::RasterizationBuffer rasterization;
+    measure("setupTriangleRasterization", type, batch_size, 1.0, "triangles", [&] {
+        for (uint32 tri_idx = 0; tri_idx < batch_size; ++tri_idx) {
+            int32 start_scanline;
+            RendererKernels::setupTriangleRasterization(*renderer, getVertex(3 * tri_idx), getVertex(3 * tri_idx + 1),
+                                                        getVertex(3 * tri_idx + 2), rasterization, start_scanline);
+            doNotOptimize(rasterization);
+        }
+    });
+
+    // A triangle covering half of the framebuffer, shaded scanline by scanline into a cleared depthbuffer so that all
+    // pixels pass the depth test.
+    const VertexSource large_sources[3] = {{{}, {static_cast<T>(0.0), static_cast<T>(0.0)}},
+                                           {{}, {static_cast<T>(0.0), static_cast<T>(1.0)}},
+                                           {{}, {static_cast<T>(1.0), static_cast<T>(0.0)}}};
+    VertexBuffer large_buffers[3];
+    const double corners[3][2] = {{0.0, 0.0}, {0.0, texture_size - 1.0}, {texture_size - 1.0, 0.0}};
+    for (uint32 corner = 0; corner < 3; ++corner) {
+        large_buffers[corner].clip_position = {static_cast<T>(corners[corner][0]), static_cast<T>(corners[corner][1]),
+                                               static_cast<T>(0.5), static_cast<T>(1.0)};
+        large_buffers[corner].screen_position = {static_cast<T>(corners[corner][0]), static_cast<T>(corners[corner][1]),
+                                                 static_cast<T>(0.5)};
+    }
+    int32 start_scanline = 0;
+    auto prepare = [&] {
+        std::fill(depthbuffer.begin(), depthbuffer.end(), static_cast<T>(0.0));
+        RendererKernels::setupTriangleRasterization(*renderer, {&large_sources[0], &large_buffers[0]},
+                                                    {&large_sources[1], &large_buffers[1]},
+                                                    {&large_sources[2], &large_buffers[2]}, rasterization, start_scanline);
+    };
+    auto shade = [&] {
+        for (int32 scanline = start_scanline; scanline <= rasterization.y_fulltri_end; ++scanline) {
+            RendererKernels::shadeScanlineOfTriangle(*renderer, rasterization, scanline);
+        }
+        doNotOptimize(framebuffer[0]);
+    };
+    prepare();
+    shade();
+    const auto num_pixels = static_cast<double>(std::count_if(depthbuffer.begin(), depthbuffer.end(), [](T depth) {
+        return depth > static_cast<T>(0.0);
+    }));
+    measure("shadeScanlineOfTriangle", type, static_cast<uint32>(rasterization.y_fulltri_end - start_scanline + 1),
+            num_pixels / (rasterization.y_fulltri_end - start_scanline + 1), "pixels", prepare, shade);
+}
+
+template<typename T, RenderDataType data_type>
+void benchmarkScalarType()
+{
+    benchmarkMath<T>();
+    benchmarkTextures<T>();
+    benchmarkRasterization<T, data_type>();
+}
+
+} // namespace
+
+int main(int argc, char* argv[])
+{
+    for (int i = 1; i + 1 < argc; i += 2) {
+        if (strcmp(argv[i], "--filter") == 0) {
+            kernel_filter = argv[i + 1];
+        }
+        else if (strcmp(argv[i], "--min-time") == 0) {
+            min_milliseconds = std::max(1.0, atof(argv[i + 1]));
+        }
+        else {
+            fprintf(stderr, "Unknown option: %s\nSee the top of benchmark/kernel_benchmark.cpp for options.\n", argv[i]);
+            return 1;
+        }
+    }
+
+    printf("kernel,type,ns_per_op,throughput,unit\n");
+    benchmarkScalarType<float, FLOATING_POINT>();
+    benchmarkScalarType<double, FLOATING_POINT>();
+    benchmarkScalarType<RenderScalar<FIXED_POINT, FULL_PRECISION>, FIXED_POINT>();
+    return 0;
+}
@@ -0,0 +1,176 @@
+#include "HeadlessBenchmark.h"
+
+#include "SimpleContours/SimpleContoursShaderProgram.h"
+#include "models/SimpleContours/cube.h"
+#include "models/SimpleContours/tu_vienna_logo.h"
+
+namespace MicroRenderer {
+
+// Shader configuration of the demo.
+constexpr ShaderConfiguration shader_cfg = {
+    PERSPECTIVE, CULL_AT_SCREEN_BORDER, CLIP_AT_NEAR_PLANE, DEPTH_TEST_ENABLED, SHADING_ENABLED,
+    {FORMAT_RGB888, SWIZZLE_NONE, TYPE_DECIMAL}
+};
+
+// Demo scene: the TU Vienna logo and two cubes. Spheres scene: grid of flat shaded spheres.
+// The shader configuration is the demo's with the benchmark's features enabled.
+template<typename T, ShaderConfiguration t_cfg>
+class SimpleContoursScene
+{
+public:
+    using ShaderProgram_type = SimpleContoursShaderProgram<T, t_cfg>;
+    using ModelData = typename ShaderProgram_type::ModelData;
+    using InstanceData = typename ShaderProgram_type::InstanceData;
+    using GlobalData = typename ShaderProgram_type::GlobalData;
+    using VertexSource = typename ShaderProgram_type::VertexSource;
+
+    explicit SimpleContoursScene(const BenchmarkOptions& options) : scene(options.scene)
+    {
+        if (scene == SCENE_DEMO) {
+            models = {cube_model<T, t_cfg>, tu_vienna_logo_model<T, t_cfg>};
+        }
+        else {
+            // Spheres fit into a 3 x 3 square around the origin.
+            grid_size = static_cast<uint16>(std::ceil(std::sqrt(static_cast<double>(options.num_sphere_instances))));
+            generateSphere(options.sphere_segments, 1.35 / grid_size, sphere_vertices, sphere_indices);
+            sphere_bounds = {Vector3<T>(-1.35 / grid_size), Vector3<T>(1.35 / grid_size)};
+            models = {{static_cast<uint16>(sphere_vertices.size()), static_cast<uint16>(sphere_indices.size()),
+                       sphere_vertices.data(), sphere_indices.data(), &sphere_bounds}};
+        }
+
+        // Preprocess triangle normals of all models. Unlike preprocessTriangleNormals(), this is done in double and
+        // leaves normals of degenerate triangles at zero, which would divide by zero in fixed-point.
+        triangle_normals.resize(models.size());
+        for (size_t model_idx = 0; model_idx < models.size(); ++model_idx) {
+            const ModelData& model = models[model_idx];
+            for (uint16 tri_idx = 0; tri_idx < model.num_triangles; ++tri_idx) {
+                const TriangleIndices& indices = model.indices[tri_idx];
+                const auto v1 = static_cast<Vector3<double>>(model.vertices[indices.vertex_1_idx].position);
+                const auto v2 = static_cast<Vector3<double>>(model.vertices[indices.vertex_2_idx].position);
+                const auto v3 = static_cast<Vector3<double>>(model.vertices[indices.vertex_3_idx].position);
+                const Vector3<double> normal = (v2 - v1).cross(v3 - v1);
+                const double length = normal.length();
+                triangle_normals[model_idx].push_back(length > 0.0 ? static_cast<Vector3<T>>(normal / length) : Vector3<T>(0.0));
+            }
+        }
+
+        if (scene == SCENE_DEMO) {
+            instances = {
+                {1, {1.0}, triangle_normals[1].data(), {0.0}, {0.0, 0.0, 255.0}},
+                {0, {1.0}, triangle_normals[0].data(), {0.0}, {255.0, 0.0, 0.0}},
+                {0, {1.0}, triangle_normals[0].data(), {0.0}, {0.0, 255.0, 0.0}}
+            };
+        }
+        else {
+            for (uint16 instance_idx = 0; instance_idx < options.num_sphere_instances; ++instance_idx) {
+                const double hue = static_cast<double>(instance_idx) / options.num_sphere_instances;
+                instances.push_back({0, {1.0}, triangle_normals[0].data(), {0.0},
+                                     static_cast<Vector3<T>>(Vector3<double>(255.0 * (1.0 - hue), 128.0, 255.0 * hue))});
+            }
+        }
+    }
+
+    const ModelData* getModels() const
+    {
+        return models.data();
+    }
+
+    InstanceData* getInstances()
+    {
+        return instances.data();
+    }
+
+    uint16 getNumInstances() const
+    {
+        return static_cast<uint16>(instances.size());
+    }
+
+    const GlobalData* getGlobalData() const
+    {
+        return &global_data;
+    }
+
+    uint16 getMaxNumVertices() const
+    {
+        uint16 max_num_vertices = 0;
+        for (const ModelData& model : models) {
+            max_num_vertices = std::max(max_num_vertices, model.num_vertices);
+        }
+        return max_num_vertices;
+    }
+
+    uint32 getNumTriangles() const
+    {
+        uint32 num_triangles = 0;
+        for (const InstanceData& instance : instances) {
+            num_triangles += models[instance.model_idx].num_triangles;
+        }
+        return num_triangles;
+    }
+
+    void update(uint32 frame, const Matrix4<double>& screen_proj_view_tf)
+    {
+        const double rotation = 180.0 + benchmark_rotation_per_frame * frame;
+        if (scene == SCENE_DEMO) {
+            // Transforms of the demo.
+            Matrix4<double> tu_logo_model_tf = Transform::translation<double>({0., 0., 0.2});
+            tu_logo_model_tf *= Transform::rotationEuler<double>({0., rotation, 0.});
+            tu_logo_model_tf *= Transform::scale<double>(Vector3<double>(0.3));
+            setInstanceTransform(instances[0], screen_proj_view_tf, tu_logo_model_tf);
+            Matrix4<double> cube_1_model_tf = Transform::translation<double>({-1.1, 0.2, -0.1});
+            cube_1_model_tf *= Transform::rotationEuler<double>({0., rotation, 0.});
+            cube_1_model_tf *= Transform::scale<double>(Vector3<double>(0.5));
+            setInstanceTransform(instances[1], screen_proj_view_tf, cube_1_model_tf);
+            Matrix4<double> cube_2_model_tf = Transform::translation<double>({-1.3, 0.4, -0.2});
+            cube_2_model_tf *= Transform::rotationEuler<double>({20., 10. + rotation, 35.});
+            cube_2_model_tf *= Transform::scale<double>(Vector3<double>(0.5));
+            setInstanceTransform(instances[2], screen_proj_view_tf, cube_2_model_tf);
+            return;
+        }
+
+        for (uint16 instance_idx = 0; instance_idx < instances.size(); ++instance_idx) {
+            const double spacing = 3.0 / grid_size;
+            const double x = (instance_idx % grid_size - 0.5 * (grid_size - 1)) * spacing;
+            const double y = (instance_idx / grid_size - 0.5 * (grid_size - 1)) * spacing;
+            Matrix4<double> sphere_model_tf = Transform::translation<double>({x, y, 0.2});
+            sphere_model_tf *= Transform::rotationEuler<double>({0., rotation + 10.0 * instance_idx, 0.});
+            setInstanceTransform(instances[instance_idx], screen_proj_view_tf, sphere_model_tf);
+        }
+    }
+
+private:
+    // Sets the screen transform and the light direction in model space of an instance.
+    static void setInstanceTransform(InstanceData& instance, const Matrix4<double>& screen_proj_view_tf,
+                                     const Matrix4<double>& model_tf)
+    {
+        const Vector3<double> towards_sun_dir_world_space = Vector3<double>(2.0, 0.3, 0.7).getNormalized();
+        instance.model_screen_tf = static_cast<Matrix4<T>>(screen_proj_view_tf * model_tf);
+        const Vector3<double> towards_sun_dir_model_space = model_tf.getMatrix3().getTranspose() * towards_sun_dir_world_space;
+        instance.towards_sun_dir_model_space = static_cast<Vector3<T>>(towards_sun_dir_model_space.getNormalized());
+    }
+
+    BenchmarkScene scene;
+
+    uint16 grid_size = 1;
+
+    std::vector<VertexSource> sphere_vertices;
+
+    std::vector<TriangleIndices> sphere_indices;
+
+    ModelBounds<T> sphere_bounds;
+
+    std::vector<ModelData> models;
+
+    std::vector<std::vector<Vector3<T>>> triangle_normals;
+
+    std::vector<InstanceData> instances;
+
+    GlobalData global_data = {};
+};
+
+std::vector<FrameResult> runSimpleContoursBenchmark(const BenchmarkOptions& options)
+{
+    return dispatchBenchmark<shader_cfg, SimpleContoursShaderProgram, SimpleContoursScene>(options);
+}
+
+} // namespace MicroRenderer
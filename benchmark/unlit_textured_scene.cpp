@@ -0,0 +1,140 @@
+#include "HeadlessBenchmark.h"
+
+#include "UnlitTextured/UnlitTexturedShaderProgram.h"
+#include "models/UnlitTextured/cube.h"
+#include "models/UnlitTextured/plane.h"
+#include "textures/RGB888/color_grid_texture.h"
+#include "textures/RGB888/tu_logo_texture.h"
+
+namespace MicroRenderer {
+
+// Shader configuration of the demo.
+constexpr ShaderConfiguration shader_cfg = {
+    PERSPECTIVE, CULL_AT_SCREEN_BORDER, CLIP_AT_NEAR_PLANE, DEPTH_TEST_ENABLED, SHADING_ENABLED,
+    {FORMAT_RGB888, SWIZZLE_NONE, TYPE_INTEGER}
+};
+
+// Demo scene: a textured cube and a double-sided logo plane. Spheres scene: grid of color grid textured spheres.
+// The shader configuration is the demo's with the benchmark's features enabled.
+template<typename T, ShaderConfiguration t_cfg>
+class UnlitTexturedScene
+{
+public:
+    using ShaderInterface = UnlitTexturedShaderInterface<T, t_cfg>;
+    using ModelData = typename ShaderInterface::ModelData;
+    using InstanceData = typename ShaderInterface::InstanceData_type;
+    using GlobalData = typename ShaderInterface::GlobalData_type;
+    using VertexSource = typename ShaderInterface::VertexSource_type;
+
+    explicit UnlitTexturedScene(const BenchmarkOptions& options) : scene(options.scene)
+    {
+        const InstanceData color_grid_instance = {0, {1.0}, {color_grid_texture, color_grid_texture_width, color_grid_texture_height}};
+        const InstanceData tu_logo_instance = {1, {1.0}, {tu_logo_texture, tu_logo_texture_width, tu_logo_texture_height}};
+        if (scene == SCENE_DEMO) {
+            models = {cube_model<T, t_cfg>, plane_model<T, t_cfg>};
+            instances = {color_grid_instance, tu_logo_instance, tu_logo_instance};
+            return;
+        }
+
+        // Spheres fit into a 3 x 3 square around the origin.
+        grid_size = static_cast<uint16>(std::ceil(std::sqrt(static_cast<double>(options.num_sphere_instances))));
+        generateSphere(options.sphere_segments, 1.35 / grid_size, sphere_vertices, sphere_indices);
+        sphere_bounds = {Vector3<T>(-1.35 / grid_size), Vector3<T>(1.35 / grid_size)};
+        models = {{static_cast<uint16>(sphere_vertices.size()), static_cast<uint16>(sphere_indices.size()),
+                   sphere_vertices.data(), sphere_indices.data(), &sphere_bounds}};
+        instances.assign(options.num_sphere_instances, color_grid_instance);
+    }
+
+    const ModelData* getModels() const
+    {
+        return models.data();
+    }
+
+    InstanceData* getInstances()
+    {
+        return instances.data();
+    }
+
+    uint16 getNumInstances() const
+    {
+        return static_cast<uint16>(instances.size());
+    }
+
+    const GlobalData* getGlobalData() const
+    {
+        return &global_data;
+    }
+
+    uint16 getMaxNumVertices() const
+    {
+        uint16 max_num_vertices = 0;
+        for (const ModelData& model : models) {
+            max_num_vertices = std::max(max_num_vertices, model.num_vertices);
+        }
+        return max_num_vertices;
+    }
+
+    uint32 getNumTriangles() const
+    {
+        uint32 num_triangles = 0;
+        for (const InstanceData& instance : instances) {
+            num_triangles += models[instance.model_idx].num_triangles;
+        }
+        return num_triangles;
+    }
+
+    void update(uint32 frame, const Matrix4<double>& screen_proj_view_tf)
+    {
+        const double rotation = 180.0 + benchmark_rotation_per_frame * frame;
+        if (scene == SCENE_DEMO) {
+            // Transforms of the demo.
+            Matrix4<double> cube_model_tf = Transform::translation<double>({-1., 0., 0.2});
+            cube_model_tf *= Transform::rotationEuler<double>({0., rotation, 0.});
+            cube_model_tf *= Transform::scale<double>(Vector3<double>(0.5));
+            instances[0].model_screen_tf = static_cast<Matrix4<T>>(screen_proj_view_tf * cube_model_tf);
+            const double plane_scale = static_cast<double>(tu_logo_texture_width) / static_cast<double>(tu_logo_texture_height);
+            Matrix4<double> plane_1_model_tf = Transform::translation<double>({1., 0., 0.2});
+            plane_1_model_tf *= Transform::rotationEuler<double>({0., 180. + rotation, 180.});
+            plane_1_model_tf *= Transform::scale<double>({plane_scale * 0.5, 0.5, 0.5});
+            instances[1].model_screen_tf = static_cast<Matrix4<T>>(screen_proj_view_tf * plane_1_model_tf);
+            Matrix4<double> plane_2_model_tf = Transform::translation<double>({1., 0., 0.2});
+            plane_2_model_tf *= Transform::rotationEuler<double>({0., rotation, 180.});
+            plane_2_model_tf *= Transform::scale<double>({plane_scale * 0.5, 0.5, 0.5});
+            instances[2].model_screen_tf = static_cast<Matrix4<T>>(screen_proj_view_tf * plane_2_model_tf);
+            return;
+        }
+
+        for (uint16 instance_idx = 0; instance_idx < instances.size(); ++instance_idx) {
+            const double spacing = 3.0 / grid_size;
+            const double x = (instance_idx % grid_size - 0.5 * (grid_size - 1)) * spacing;
+            const double y = (instance_idx / grid_size - 0.5 * (grid_size - 1)) * spacing;
+            Matrix4<double> sphere_model_tf = Transform::translation<double>({x, y, 0.2});
+            sphere_model_tf *= Transform::rotationEuler<double>({0., rotation + 10.0 * instance_idx, 0.});
+            instances[instance_idx].model_screen_tf = static_cast<Matrix4<T>>(screen_proj_view_tf * sphere_model_tf);
+        }
+    }
+
+private:
+    BenchmarkScene scene;
+
+    uint16 grid_size = 1;
+
+    std::vector<VertexSource> sphere_vertices;
+
+    std::vector<TriangleIndices> sphere_indices;
+
+    ModelBounds<T> sphere_bounds;
+
+    std::vector<ModelData> models;
+
+    std::vector<InstanceData> instances;
+
+    GlobalData global_data = {};
+};
+
+std::vector<FrameResult> runUnlitTexturedBenchmark(const BenchmarkOptions& options)
+{
+    return dispatchBenchmark<shader_cfg, UnlitTexturedShaderProgram, UnlitTexturedScene>(options);
+}
+
+} // namespace MicroRenderer
@@ -9,7 +9,8 @@
  * 1. MODE_FREEFLY: Allows freefly navigation by 'WASDQE' for movement and the arrow keys for rotation.
  *					The image can be saved as .ppm files by pressing the 'P' key.
  *					Color/Depth information display can be toggled by pressing the 'Space' key.
- * 2. MODE_CAPTURE_STATS: Captures a number of frames and then prints performance metrics to console.
+ * 2. MODE_CAPTURE_STATS: Captures a number of frames and then prints performance metrics to console, including
+ *						   frame time percentiles of the whole frame, render() and the scanline loop.
  *
  * Two shaders can be selected under --- Demo Configuration --- below:
  * 1. SHADER_SIMPLECONTOURS: see shaders directory.
@@ -46,6 +47,7 @@ constexpr ShaderConfiguration my_shader_cfg = {
 	{FORMAT_RGB888, SWIZZLE_NONE, TYPE_INTEGER}
 };
 constexpr RendererConfiguration my_renderer_cfg = {SCANLINE, CLOCKWISE, my_shader_cfg};
+constexpr int16 num_scanlines_per_bucket = 8;
 
 // ------------------ Renderer configuration --------------------- //
 
@@ -86,6 +88,7 @@ MyRenderer::VertexBuffer vertex_buffer[num_vertex_buffers];
 constexpr uint16 num_rasterization_structs = 400;
 MyRenderer::RasterizationBuffer rasterization_buffers[num_rasterization_structs];
 MyRenderer::RasterizationOrder rasterization_order[num_rasterization_structs];
+uint16 rasterization_histogram[window_height + 1];
 
 // Frame/depthbuffer.
 void* framebuffer_address = nullptr;
@@ -199,6 +202,8 @@ void initializeRenderer()
 	my_renderer.setGlobalData(&global_data);
 	my_renderer.setVertexBuffers(vertex_buffer);
 	my_renderer.setRasterizationBuffers(rasterization_buffers, rasterization_order, num_rasterization_structs);
+	my_renderer.setRasterizationHistogram(rasterization_histogram);
+	my_renderer.setScanlinesPerBucket(num_scanlines_per_bucket);
 }
 
 void updateRenderer(DataType delta_time)
@@ -286,17 +291,26 @@ void clearRenderer()
 	my_renderer.setResolution(window_width, window_height);
 }
 
+// Durations of render() and the scanline loop of the last draw in microseconds.
+uint32 render_time = 0;
+uint32 scanlines_time = 0;
+
 void drawRenderer()
 {
+	auto start = std::chrono::high_resolution_clock::now();
 	my_renderer.render();
-
-	for (int32 y = 0; y < window_height; ++y) {
-		void* framebuffer_scanline = static_cast<MyRenderer::Framebuffer::InternalType*>(framebuffer_address) + y * window_width;
-		void* depthbuffer_scanline = static_cast<MyRenderer::Depthbuffer::InternalType*>(depthbuffer_address) + y * window_width;
-		my_renderer.setFramebuffer(framebuffer_scanline);
-		my_renderer.setDepthbuffer(depthbuffer_scanline);
-		my_renderer.renderNextScanline();
+	auto render_stop = std::chrono::high_resolution_clock::now();
+
+	for (int32 y = 0; y < window_height; y += num_scanlines_per_bucket) {
+		void* framebuffer_bucket = static_cast<MyRenderer::Framebuffer::InternalType*>(framebuffer_address) + y * window_width;
+		void* depthbuffer_bucket = static_cast<MyRenderer::Depthbuffer::InternalType*>(depthbuffer_address) + y * window_width;
+		my_renderer.setFramebuffer(framebuffer_bucket);
+		my_renderer.setDepthbuffer(depthbuffer_bucket);
+		my_renderer.renderNextScanlineBand();
 	}
+
+	render_time = std::chrono::duration_cast<std::chrono::microseconds>(render_stop - start).count();
+	scanlines_time = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::high_resolution_clock::now() - render_stop).count();
 }
 
 // ------------------ Rendering functions --------------------- //
@@ -324,10 +338,9 @@ std::chrono::time_point<std::chrono::steady_clock> last_frame_time;
 // Stats.
 volatile uint32 frame_time = 0;
 constexpr uint32 capture_num_frames = 3600;
-uint32 min_frame_time = 0xFFFFFFFF;
-uint32 max_frame_time = 0;
-uint32 sum_frame_time = 0;
-uint32 num_frames = 0;
+FrameTimeHistogram frame_times;
+FrameTimeHistogram render_times;
+FrameTimeHistogram scanlines_times;
 bool stats_printed = false;
 
 void handleSDLError(int error_code)
@@ -481,7 +494,7 @@ void draw()
 		}
 	}
 #elif DEMO_MODE == MODE_CAPTURE_STATS
-	if (num_frames < capture_num_frames) {
+	if (frame_times.getNumFrames() < capture_num_frames) {
 		// Clear call.
 		clearRenderer();
 
@@ -492,28 +505,36 @@ void draw()
 		frame_time += std::chrono::duration_cast<std::chrono::microseconds>(elapsed).count();
 
 		// Update rendering time stats.
-		sum_frame_time += frame_time;
-		if (frame_time < min_frame_time)
-			min_frame_time = frame_time;
-		if (frame_time > max_frame_time)
-			max_frame_time = frame_time;
+		frame_times.record(frame_time);
+		render_times.record(render_time);
+		scanlines_times.record(scanlines_time);
 
 		// Print remaining frames info to console.
-		++num_frames;
-		printf("\nFRAMES: %i/%i", num_frames, capture_num_frames);
+		printf("\nFRAMES: %i/%i", frame_times.getNumFrames(), capture_num_frames);
 	}
 	else if (!stats_printed) {
 		// Print rendering time stats info to console.
 		printf("\n\nSTATS CAPTURED.");
-		const double avg_time = static_cast<double>(sum_frame_time) / static_cast<double>(capture_num_frames) / 1000.0;
+		const double avg_time = frame_times.getMean() / 1000.0;
 		printf("\nAvg [ms]: %f", avg_time);
-		const double min_time = static_cast<double>(min_frame_time) / 1000.0;
+		const double min_time = static_cast<double>(frame_times.getMin()) / 1000.0;
 		printf("\nMin [ms]: %f", min_time);
-		const double max_time = static_cast<double>(max_frame_time) / 1000.0;
+		const double max_time = static_cast<double>(frame_times.getMax()) / 1000.0;
 		printf("\nMax [ms]: %f", max_time);
 		printf("\nAvg [fps]: %f", 1000.0 / avg_time);
 		printf("\nMin [fps]: %f", 1000.0 / max_time);
 		printf("\nMax [fps]: %f", 1000.0 / min_time);
+
+		// Percentiles of the frame (update and draw), render() and the scanline loop.
+		const char* names[3] = {"Frame", "Render", "Scanlines"};
+		const FrameTimeHistogram* histograms[3] = {&frame_times, &render_times, &scanlines_times};
+		for (uint32 i = 0; i < 3; ++i) {
+			const FrameTimeHistogram& histogram = *histograms[i];
+			printf("\n%s [ms]: p50: %f, p90: %f, p99: %f, p99.9: %f, Jitter: %f, Std. dev.: %f", names[i],
+				   histogram.getPercentile(50.0) / 1000.0, histogram.getPercentile(90.0) / 1000.0,
+				   histogram.getPercentile(99.0) / 1000.0, histogram.getPercentile(99.9) / 1000.0,
+				   histogram.getJitter() / 1000.0, histogram.getStandardDeviation() / 1000.0);
+		}
 		stats_printed = true;
 	}
 #endif
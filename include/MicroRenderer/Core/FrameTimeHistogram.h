@@ -0,0 +1,140 @@
+#pragma once
+#include <algorithm>
+#include <bit>
+#include <cmath>
+#include "MicroRenderer/Math/ScalarTypes.h"
+
+namespace MicroRenderer {
+
+// Distribution of frame times in microseconds, for percentiles that averages hide. Times are counted in logarithmic
+// buckets of fixed size, 16 per power of two, so percentiles are accurate to about 3%. Minimum, maximum, mean and
+// jitter are exact.
+class FrameTimeHistogram
+{
+public:
+    static constexpr uint32 SUB_BUCKETS_LOG2 = 4;
+    static constexpr uint32 NUM_SUB_BUCKETS = 1 << SUB_BUCKETS_LOG2;
+    // Times below 2 * NUM_SUB_BUCKETS have a bucket each, every following power of two has NUM_SUB_BUCKETS.
+    static constexpr uint32 NUM_BUCKETS = (32 - SUB_BUCKETS_LOG2 + 1) * NUM_SUB_BUCKETS;
+
+    void record(uint32 microseconds)
+    {
+        ++buckets[getBucketIdx(microseconds)];
+        if (num_frames > 0) {
+            const uint32 delta = microseconds > last_time ? microseconds - last_time : last_time - microseconds;
+            sum_deltas += delta;
+        }
+        ++num_frames;
+        min_time = std::min(min_time, microseconds);
+        max_time = std::max(max_time, microseconds);
+        sum_times += microseconds;
+        sum_squared_times += static_cast<double>(microseconds) * microseconds;
+        last_time = microseconds;
+    }
+
+    void reset()
+    {
+        *this = {};
+    }
+
+    uint32 getNumFrames() const
+    {
+        return num_frames;
+    }
+
+    uint32 getMin() const
+    {
+        return num_frames > 0 ? min_time : 0;
+    }
+
+    uint32 getMax() const
+    {
+        return max_time;
+    }
+
+    double getMean() const
+    {
+        return num_frames > 0 ? static_cast<double>(sum_times) / num_frames : 0.0;
+    }
+
+    double getStandardDeviation() const
+    {
+        if (num_frames == 0) {
+            return 0.0;
+        }
+        const double mean = getMean();
+        return std::sqrt(std::max(sum_squared_times / num_frames - mean * mean, 0.0));
+    }
+
+    // Mean absolute difference between consecutive frame times.
+    double getJitter() const
+    {
+        return num_frames > 1 ? static_cast<double>(sum_deltas) / (num_frames - 1) : 0.0;
+    }
+
+    // Time that the given percentage of frames do not exceed, e.g. 99.9 for the 99.9th percentile. Returns the center
+    // of the bucket holding that frame, clamped to the exact minimum and maximum.
+    double getPercentile(double percentage) const
+    {
+        if (num_frames == 0) {
+            return 0.0;
+        }
+        const auto rank = static_cast<uint64>(std::ceil(std::clamp(percentage, 0.0, 100.0) / 100.0 * num_frames));
+        uint64 count = 0;
+        uint32 bucket_idx = 0;
+        for (; bucket_idx < NUM_BUCKETS - 1; ++bucket_idx) {
+            count += buckets[bucket_idx];
+            if (count >= std::max<uint64>(rank, 1)) {
+                break;
+            }
+        }
+        const double center = getBucketStart(bucket_idx) + 0.5 * (getBucketWidth(bucket_idx) - 1);
+        return std::clamp(center, static_cast<double>(getMin()), static_cast<double>(max_time));
+    }
+private:
+    static uint32 getBucketIdx(uint32 microseconds)
+    {
+        if (microseconds < 2 * NUM_SUB_BUCKETS) {
+            return microseconds;
+        }
+        // Power of two of the time and the next SUB_BUCKETS_LOG2 bits below its leading one.
+        const uint32 exponent = std::bit_width(microseconds) - 1;
+        const uint32 sub_bucket = (microseconds >> (exponent - SUB_BUCKETS_LOG2)) & (NUM_SUB_BUCKETS - 1);
+        return (exponent - SUB_BUCKETS_LOG2 + 1) * NUM_SUB_BUCKETS + sub_bucket;
+    }
+
+    static double getBucketStart(uint32 bucket_idx)
+    {
+        if (bucket_idx < 2 * NUM_SUB_BUCKETS) {
+            return bucket_idx;
+        }
+        const uint32 exponent = bucket_idx / NUM_SUB_BUCKETS + SUB_BUCKETS_LOG2 - 1;
+        return std::ldexp(NUM_SUB_BUCKETS + bucket_idx % NUM_SUB_BUCKETS, exponent - SUB_BUCKETS_LOG2);
+    }
+
+    static double getBucketWidth(uint32 bucket_idx)
+    {
+        if (bucket_idx < 2 * NUM_SUB_BUCKETS) {
+            return 1.0;
+        }
+        return std::ldexp(1.0, bucket_idx / NUM_SUB_BUCKETS - 1);
+    }
+
+    uint32 buckets[NUM_BUCKETS] = {};
+
+    uint32 num_frames = 0;
+
+    uint32 min_time = 0xFFFFFFFF;
+
+    uint32 max_time = 0;
+
+    uint32 last_time = 0;
+
+    uint64 sum_times = 0;
+
+    uint64 sum_deltas = 0;
+
+    double sum_squared_times = 0.0;
+};
+
+} // namespace MicroRenderer
@@ -0,0 +1,72 @@
+#pragma once
+#include <algorithm>
+#include "MicroRenderer/Math/ScalarTypes.h"
+
+namespace MicroRenderer {
+
+// Work counters of the renderer, accumulated from one render() call to the next. Only counted if
+// MICRORENDERER_STATISTICS is defined, otherwise counting compiles to nothing.
+struct RenderStatistics
+{
+    // Instances whose bounding box is entirely outside the screen or behind the near plane.
+    uint32 instances_culled = 0;
+
+    uint32 vertices_shaded = 0;
+
+    uint32 triangles_backface_culled = 0;
+
+    uint32 triangles_outcode_culled = 0;
+
+    // Triangles skipped with their cluster, which was off screen, behind the near plane or back-facing as a whole.
+    uint32 triangles_cluster_culled = 0;
+
+    // Triangles partially behind the near plane, clipped into one or two triangles.
+    uint32 triangles_clipped_to_one = 0;
+
+    uint32 triangles_clipped_to_two = 0;
+
+    uint32 triangles_set_up = 0;
+
+    // Triangles that did not fit into rasterization buffers, triangle records or tile bin entries at all.
+    uint32 triangles_dropped = 0;
+
+    // Pixels covered by rasterized spans, whether depth-tested, rejected per depth block or shaded.
+    uint32 fragments_generated = 0;
+
+    uint32 depth_tests_passed = 0;
+
+    uint32 colors_computed = 0;
+
+    // Render mode 'SCANLINE': most triangles active during one bucket of scanlines.
+    uint32 peak_active_triangles = 0;
+
+    // Adds the counters of another renderer, e.g. of a worker thread.
+    void merge(const RenderStatistics& other)
+    {
+        instances_culled += other.instances_culled;
+        vertices_shaded += other.vertices_shaded;
+        triangles_backface_culled += other.triangles_backface_culled;
+        triangles_outcode_culled += other.triangles_outcode_culled;
+        triangles_cluster_culled += other.triangles_cluster_culled;
+        triangles_clipped_to_one += other.triangles_clipped_to_one;
+        triangles_clipped_to_two += other.triangles_clipped_to_two;
+        triangles_set_up += other.triangles_set_up;
+        triangles_dropped += other.triangles_dropped;
+        fragments_generated += other.fragments_generated;
+        depth_tests_passed += other.depth_tests_passed;
+        colors_computed += other.colors_computed;
+        peak_active_triangles = std::max(peak_active_triangles, other.peak_active_triangles);
+    }
+};
+
+// Counting inside the renderer. Arguments are not evaluated unless statistics are enabled.
+#ifdef MICRORENDERER_STATISTICS
+#define MICRORENDERER_COUNT(counter, amount) (statistics.counter += static_cast<uint32>(amount))
+#define MICRORENDERER_COUNT_PEAK(counter, value) \
+    (statistics.counter = std::max(statistics.counter, static_cast<uint32>(value)))
+#else
+#define MICRORENDERER_COUNT(counter, amount) static_cast<void>(0)
+#define MICRORENDERER_COUNT_PEAK(counter, value) static_cast<void>(0)
+#endif
+
+} // namespace MicroRenderer
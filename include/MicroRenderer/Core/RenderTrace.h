@@ -0,0 +1,215 @@
+#pragma once
+#include "MicroRenderer/Math/ScalarTypes.h"
+
+#ifdef MICRORENDERER_TRACE
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <string>
+
+namespace MicroRenderer {
+
+enum TraceEventType : uint32
+{
+    TRACE_SCOPE,
+    TRACE_COUNTER,
+    NUM_TRACE_EVENT_TYPES
+};
+
+struct TraceEvent
+{
+    // Names and argument names are string literals.
+    const char* name;
+    const char* arg_name;
+    TraceEventType type;
+    uint32 frame;
+    uint32 thread_idx;
+    // Argument of scopes (e.g. scanline or tile index) or value of counters.
+    int32 value;
+    // Nanoseconds since the trace was created.
+    int64 start_ns;
+    int64 duration_ns;
+};
+
+// Timeline of renderer stages over a range of frames, which can be saved in the Chrome trace event format and viewed
+// in chrome://tracing or Perfetto. Only recorded if MICRORENDERER_TRACE is defined, otherwise tracing compiles to
+// nothing. Scopes may be recorded from multiple threads.
+class RenderTrace
+{
+public:
+    using Clock = std::chrono::steady_clock;
+
+    RenderTrace() : origin(Clock::now()) {}
+
+    // Events are stored in the buffer until it is full.
+    void setEventBuffer(TraceEvent* events, uint32 size_in_elements)
+    {
+        this->events = events;
+        max_num_events = size_in_elements;
+        num_events = 0;
+    }
+
+    // Frames are counted by render() calls, starting at 0.
+    void setCaptureRange(uint32 first_frame, uint32 num_frames)
+    {
+        capture_first_frame = first_frame;
+        capture_num_frames = num_frames;
+    }
+
+    // Called by render() before anything else.
+    void beginFrame()
+    {
+        ++frame;
+        capturing = frame - capture_first_frame < capture_num_frames;
+    }
+
+    bool isCapturing() const
+    {
+        return capturing;
+    }
+
+    uint32 getNumEvents() const
+    {
+        return std::min(num_events.load(), max_num_events);
+    }
+
+    // Events that did not fit into the buffer.
+    uint32 getNumDroppedEvents() const
+    {
+        return num_events.load() - getNumEvents();
+    }
+
+    void recordScope(const char* name, const char* arg_name, int32 value, Clock::time_point start)
+    {
+        const int64 start_ns = toNanoseconds(start);
+        record({name, arg_name, TRACE_SCOPE, frame, getThreadIdx(), value, start_ns, toNanoseconds(Clock::now()) - start_ns});
+    }
+
+    void recordCounter(const char* name, int32 value)
+    {
+        if (capturing) {
+            record({name, name, TRACE_COUNTER, frame, getThreadIdx(), value, toNanoseconds(Clock::now()), 0});
+        }
+    }
+
+    bool saveToChromeTrace(const std::string& file_name) const
+    {
+        FILE* file = fopen(file_name.c_str(), "w");
+        if (file == nullptr) {
+            return false;
+        }
+        fprintf(file, "{\"traceEvents\":[\n");
+        const uint32 num_saved_events = getNumEvents();
+        for (uint32 event_idx = 0; event_idx < num_saved_events; ++event_idx) {
+            const TraceEvent& event = events[event_idx];
+            // Timestamps are in microseconds.
+            fprintf(file, "{\"name\":\"%s\",\"cat\":\"MicroRenderer\",\"ph\":\"%s\",\"pid\":0,\"tid\":%u,\"ts\":%.3f,",
+                    event.name, event.type == TRACE_SCOPE ? "X" : "C", event.thread_idx, event.start_ns * 1e-3);
+            if (event.type == TRACE_SCOPE) {
+                fprintf(file, "\"dur\":%.3f,\"args\":{\"frame\":%u", event.duration_ns * 1e-3, event.frame);
+                if (event.arg_name != nullptr) {
+                    fprintf(file, ",\"%s\":%d", event.arg_name, event.value);
+                }
+                fprintf(file, "}");
+            }
+            else {
+                fprintf(file, "\"args\":{\"%s\":%d}", event.arg_name, event.value);
+            }
+            fprintf(file, "}%s\n", event_idx + 1 < num_saved_events ? "," : "");
+        }
+        fprintf(file, "]}\n");
+        return fclose(file) == 0;
+    }
+private:
+    void record(const TraceEvent& event)
+    {
+        const uint32 event_idx = num_events.fetch_add(1, std::memory_order_relaxed);
+        if (event_idx < max_num_events) {
+            events[event_idx] = event;
+        }
+    }
+
+    int64 toNanoseconds(Clock::time_point time) const
+    {
+        return std::chrono::duration_cast<std::chrono::nanoseconds>(time - origin).count();
+    }
+
+    // Small consecutive thread numbers in order of the threads' first event.
+    static uint32 getThreadIdx()
+    {
+        static std::atomic<uint32> num_threads = 0;
+        thread_local const uint32 thread_idx = num_threads.fetch_add(1, std::memory_order_relaxed);
+        return thread_idx;
+    }
+
+    Clock::time_point origin;
+
+    TraceEvent* events = nullptr;
+
+    uint32 max_num_events = 0;
+
+    // Includes dropped events.
+    std::atomic<uint32> num_events = 0;
+
+    // Incremented to 0 by the first frame.
+    uint32 frame = 0xFFFFFFFF;
+
+    uint32 capture_first_frame = 0;
+
+    uint32 capture_num_frames = 0;
+
+    bool capturing = false;
+};
+
+// Records a scope from construction to destruction if its trace is capturing.
+class TraceScope
+{
+public:
+    TraceScope(RenderTrace* trace, const char* name, const char* arg_name = nullptr, int32 value = 0)
+        : trace(trace != nullptr && trace->isCapturing() ? trace : nullptr), name(name), arg_name(arg_name), value(value)
+    {
+        if (this->trace != nullptr) {
+            start = RenderTrace::Clock::now();
+        }
+    }
+
+    ~TraceScope()
+    {
+        if (trace != nullptr) {
+            trace->recordScope(name, arg_name, value, start);
+        }
+    }
+
+    TraceScope(const TraceScope&) = delete;
+
+    TraceScope& operator=(const TraceScope&) = delete;
+private:
+    RenderTrace* trace;
+
+    const char* name;
+
+    const char* arg_name;
+
+    int32 value;
+
+    RenderTrace::Clock::time_point start;
+};
+
+} // namespace MicroRenderer
+#endif
+
+// Tracing inside the renderer. Arguments are not evaluated unless tracing is enabled.
+#ifdef MICRORENDERER_TRACE
+#define MICRORENDERER_TRACE_CONCAT_IMPL(a, b) a##b
+#define MICRORENDERER_TRACE_CONCAT(a, b) MICRORENDERER_TRACE_CONCAT_IMPL(a, b)
+#define MICRORENDERER_TRACE_SCOPE(name) const TraceScope MICRORENDERER_TRACE_CONCAT(trace_scope_, __LINE__)(trace, name)
+#define MICRORENDERER_TRACE_SCOPE_ARG(name, arg_name, value) \
+    const TraceScope MICRORENDERER_TRACE_CONCAT(trace_scope_, __LINE__)(trace, name, arg_name, static_cast<int32>(value))
+#define MICRORENDERER_TRACE_COUNTER(name, value) \
+    (trace != nullptr ? trace->recordCounter(name, static_cast<int32>(value)) : static_cast<void>(0))
+#else
+#define MICRORENDERER_TRACE_SCOPE(name) static_cast<void>(0)
+#define MICRORENDERER_TRACE_SCOPE_ARG(name, arg_name, value) static_cast<void>(0)
+#define MICRORENDERER_TRACE_COUNTER(name, value) static_cast<void>(0)
+#endif
@@ -5,33 +5,51 @@
 #pragma once
 #include <variant>
 #include "MicroRenderer/Textures/Texture2D.h"
+#include "MicroRenderer/Math/FixedPoint.h"
 #include "MicroRenderer/Math/ScalarTypes.h"
 #include "MicroRenderer/Math/Vector2.h"
 #include "MicroRenderer/Math/Vector3.h"
+#include "MicroRenderer/Math/Matrix4.h"
 #include "MicroRenderer/Shading/ShaderProgram.h"
+#include "MicroRenderer/Core/RenderStatistics.h"
+#include "MicroRenderer/Core/RenderTrace.h"
+#ifdef MICRORENDERER_MULTITHREADING
+#include "MicroRenderer/Core/TileScheduler.h"
+#endif
+#ifdef MICRORENDERER_SIMD
+#include "MicroRenderer/Core/SimdDepthTest.h"
+#endif
 
 namespace MicroRenderer {
 
-// POSSIBLE_FEATURE: selectable float/fp and precision through RendererConfiguration
-// enum RenderDataType : uint32
-// {
-//     FLOATING_POINT,
-//     FIXED_POINT,
-//     NUM_RENDER_DATA_TYPES
-// };
-//
-// enum PrecisionMode : uint32
-// {
-//     HALF_PRECISION,
-//     MIXED_PRECISION,
-//     FULL_PRECISION,
-//     NUM_PRECISION_MODES
-// };
+enum RenderDataType : uint32
+{
+    FLOATING_POINT,
+    FIXED_POINT,
+    NUM_RENDER_DATA_TYPES
+};
+
+enum PrecisionMode : uint32
+{
+    HALF_PRECISION,
+    MIXED_PRECISION,
+    FULL_PRECISION,
+    NUM_PRECISION_MODES
+};
+
+// Scalar type for a data type and precision mode, to be used as the renderer's template type T.
+// FLOATING_POINT: float, float, double. FIXED_POINT: Q16.16, Q40.24 (int64), Q32.32 (int64).
+template<RenderDataType data_type, PrecisionMode precision>
+using RenderScalar = std::conditional_t<data_type == FLOATING_POINT,
+    std::conditional_t<precision == FULL_PRECISION, double, float>,
+    std::conditional_t<precision == HALF_PRECISION, FixedPoint<16>,
+        std::conditional_t<precision == MIXED_PRECISION, FixedPoint<24, int64>, FixedPoint<32, int64>>>>;
 
 enum RenderMode : uint32
 {
     FRAMEBUFFER,
     SCANLINE,
+    TILED,
     NUM_RENDER_MODES
 };
 
@@ -42,23 +60,82 @@ enum FrontFace : uint32
     NUM_FRONT_FACE_MODES
 };
 
+// Keeps the minimum depth (reversed-z: farthest) of each 8x8 pixel block to skip occluded spans before per-pixel work.
+enum HierarchicalDepthMode : uint32
+{
+    HIERARCHICAL_DEPTH_ENABLED,
+    HIERARCHICAL_DEPTH_DISABLED,
+    NUM_HIERARCHICAL_DEPTH_MODES
+};
+
+// Stores a compact record per triangle in render mode 'SCANLINE' and sets up rasterization only once a triangle becomes
+// active, so that rasterization buffers are only needed for simultaneously active triangles.
+enum DeferredSetupMode : uint32
+{
+    DEFERRED_SETUP_ENABLED,
+    DEFERRED_SETUP_DISABLED,
+    NUM_DEFERRED_SETUP_MODES
+};
+
+// Rasterizes depth and the visible triangle of each pixel first, then runs the fragment shader once per covered pixel.
+enum DeferredShadingMode : uint32
+{
+    DEFERRED_SHADING_ENABLED,
+    DEFERRED_SHADING_DISABLED,
+    NUM_DEFERRED_SHADING_MODES
+};
+
+// Interpolates only depth along scanlines and evaluates the other attributes directly at pixels passing the depth test,
+// which skips the attribute work of occluded pixels and the drift of long incremental walks in x.
+enum LazyAttributeMode : uint32
+{
+    LAZY_ATTRIBUTES_ENABLED,
+    LAZY_ATTRIBUTES_DISABLED,
+    NUM_LAZY_ATTRIBUTE_MODES
+};
+
 struct RendererConfiguration
 {
-    // RenderDataType data_type; POSSIBLE_FEATURE: selectable float/fp and precision through RendererConfiguration
-    // PrecisionMode precision; POSSIBLE_FEATURE: selectable float/fp and precision through RendererConfiguration
     RenderMode render_mode;
     FrontFace front_face;
     ShaderConfiguration shader_cfg;
+    RenderDataType data_type = FLOATING_POINT;
+    PrecisionMode precision = FULL_PRECISION;
+    HierarchicalDepthMode hierarchical_depth = HIERARCHICAL_DEPTH_DISABLED;
+    DeferredShadingMode deferred_shading = DEFERRED_SHADING_DISABLED;
+    DeferredSetupMode deferred_setup = DEFERRED_SETUP_DISABLED;
+    LazyAttributeMode lazy_attributes = LAZY_ATTRIBUTES_DISABLED;
 };
 
 template<typename T, RendererConfiguration t_cfg, template <typename, ShaderConfiguration> class ShaderProgram>
 class Renderer {
-    //static_assert(t_cfg.data_type < NUM_RENDER_DATA_TYPES, "Renderer: Invalid render data type in configuration!"); POSSIBLE_FEATURE: selectable float/fp and precision through RendererConfiguration
-    //static_assert(t_cfg.precision < NUM_PRECISION_MODES, "Renderer: Invalid precision mode in configuration!"); POSSIBLE_FEATURE: selectable float/fp and precision through RendererConfiguration
+    static_assert(t_cfg.data_type < NUM_RENDER_DATA_TYPES, "Renderer: Invalid render data type in configuration!");
+    static_assert(t_cfg.precision < NUM_PRECISION_MODES, "Renderer: Invalid precision mode in configuration!");
+    static_assert(is_fixed_point_v<T> == (t_cfg.data_type == FIXED_POINT), "Renderer: Template type T does not match render data type in configuration!");
     static_assert(t_cfg.render_mode < NUM_RENDER_MODES, "Renderer: Invalid render mode in configuration!");
     static_assert(t_cfg.front_face < NUM_FRONT_FACE_MODES, "Renderer: Invalid front face mode in configuration!");
+    static_assert(t_cfg.hierarchical_depth < NUM_HIERARCHICAL_DEPTH_MODES, "Renderer: Invalid hierarchical depth mode in configuration!");
+    static_assert(t_cfg.hierarchical_depth == HIERARCHICAL_DEPTH_DISABLED || t_cfg.shader_cfg.depth_test == DEPTH_TEST_ENABLED,
+                  "Renderer: Hierarchical depth requires depth test!");
+    static_assert(t_cfg.hierarchical_depth == HIERARCHICAL_DEPTH_DISABLED || t_cfg.render_mode != SCANLINE,
+                  "Renderer: Hierarchical depth is not supported in render mode 'SCANLINE'!");
+    static_assert(t_cfg.deferred_shading < NUM_DEFERRED_SHADING_MODES, "Renderer: Invalid deferred shading mode in configuration!");
+    static_assert(t_cfg.deferred_shading == DEFERRED_SHADING_DISABLED ||
+                  (t_cfg.render_mode == TILED && t_cfg.shader_cfg.shading == SHADING_ENABLED && t_cfg.shader_cfg.depth_test == DEPTH_TEST_ENABLED),
+                  "Renderer: Deferred shading requires render mode 'TILED' with shading and depth test!");
+    static_assert(t_cfg.deferred_setup < NUM_DEFERRED_SETUP_MODES, "Renderer: Invalid deferred setup mode in configuration!");
+    static_assert(t_cfg.deferred_setup == DEFERRED_SETUP_DISABLED || t_cfg.render_mode == SCANLINE,
+                  "Renderer: Deferred setup requires render mode 'SCANLINE'!");
+    static_assert(t_cfg.lazy_attributes < NUM_LAZY_ATTRIBUTE_MODES, "Renderer: Invalid lazy attribute mode in configuration!");
+    static_assert(t_cfg.lazy_attributes == LAZY_ATTRIBUTES_DISABLED ||
+                  (t_cfg.shader_cfg.shading == SHADING_ENABLED && t_cfg.shader_cfg.depth_test == DEPTH_TEST_ENABLED &&
+                   t_cfg.deferred_shading == DEFERRED_SHADING_DISABLED),
+                  "Renderer: Lazy attributes require shading and depth test without deferred shading!");
+    static_assert(t_cfg.shader_cfg.perspective_correction == PERSPECTIVE_CORRECTION_DISABLED ||
+                  (t_cfg.shader_cfg.shading == SHADING_ENABLED && t_cfg.shader_cfg.depth_test == DEPTH_TEST_ENABLED &&
+                   t_cfg.deferred_shading == DEFERRED_SHADING_DISABLED),
+                  "Renderer: Perspective correction requires shading and depth test without deferred shading!");
 public:
-    //using T = std::conditional_t<t_cfg.data_type == FLOATING_POINT, float, void>; POSSIBLE_FEATURE: selectable float/fp and precision through RendererConfiguration
     using ShaderProgram_type = ShaderProgram<T, t_cfg.shader_cfg>;
     USE_SHADER_INTERFACE(ShaderProgram_type::ShaderInterface);
     static constexpr TextureConfiguration framebuffer_cfg = {
@@ -68,13 +145,28 @@ public:
     static constexpr TextureConfiguration depthbuffer_cfg = {
         ACCESS_READWRITE, FORMAT_DEPTH, SWIZZLE_NONE, TYPE_DECIMAL, WRAPMODE_NONE
     };
+    // Edge length in pixels of the square screen tiles used in render mode 'TILED'.
+    static constexpr int32 tile_size = 32;
+    // Whether colors are computed for spans of up to color_span_size pixels at once instead of pixel by pixel.
+    static constexpr bool span_shading = t_cfg.shader_cfg.shading == SHADING_ENABLED && ShaderProgram_type::span_shading;
+    // Whether depth-tested spans of triangles with attributes constant along scanlines are filled with a single color.
+    static constexpr bool flat_spans = t_cfg.shader_cfg.shading == SHADING_ENABLED &&
+                                       t_cfg.shader_cfg.depth_test == DEPTH_TEST_ENABLED &&
+                                       t_cfg.deferred_shading == DEFERRED_SHADING_DISABLED &&
+                                       ShaderProgram_type::flat_triangles;
+    static constexpr bool perspective_correction = t_cfg.shader_cfg.perspective_correction == PERSPECTIVE_CORRECTION_ENABLED;
+    // Whether only depth is interpolated along scanlines, and the other attributes are evaluated at depth-passing pixels.
+    static constexpr bool lazy_x_attributes = t_cfg.lazy_attributes == LAZY_ATTRIBUTES_ENABLED || perspective_correction;
     using Framebuffer = std::conditional_t<t_cfg.shader_cfg.shading == SHADING_ENABLED, Texture2D<T, framebuffer_cfg>, std::monostate>;
     using Depthbuffer = std::conditional_t<t_cfg.shader_cfg.depth_test == DEPTH_TEST_ENABLED, Texture2D<T, depthbuffer_cfg>, std::monostate>;
     using NearPlaneType = std::conditional_t<t_cfg.shader_cfg.projection == PERSPECTIVE, T, std::monostate>;
     struct RasterizationBuffer
     {
         bool last_is_left;
+        // Whether the triangle's attributes are constant along scanlines, decided at setup.
+        std::conditional_t<flat_spans, bool, std::monostate> constant_in_x;
         uint16 instance_idx;
+        int16 start_scanline;
         int16 prev_scanline_stop_x;
         int16 y_halftri_end;
         int16 y_fulltri_end;
@@ -84,11 +176,23 @@ public:
         T left_x;
         T right_x;
         T last_x;
+        // With lazy attributes, x the attributes other than depth are interpolated at, depth is at prev_scanline_stop_x.
+        std::conditional_t<lazy_x_attributes, int16, std::monostate> attribute_x;
         TriangleBuffer triangle_buffer;
     };
+    // Triangle whose rasterization setup is deferred until its start scanline.
+    struct TriangleRecord
+    {
+        uint16 instance_idx;
+        uint16 tri_idx;
+        int16 start_scanline;
+        // Which of both triangles resulting from clipping, 0 if the triangle is not split.
+        uint8 clip_half;
+    };
     struct RasterizationOrder
     {
         int16 scanline;
+        // Index of rasterization buffer, or of triangle record if setup is deferred.
         uint16 buffer_idx;
 
         friend bool operator<(const RasterizationOrder& lhs, const RasterizationOrder& rhs)
@@ -102,6 +206,33 @@ public:
 
         RasterizationOrder* order = nullptr;
 
+        uint16* histogram = nullptr;
+
+        TriangleRecord* records = nullptr;
+
+        uint16 max_num_records = 0;
+
+        uint16 num_records = 0;
+
+        // Indices of rasterization buffers, active ones first, followed by free ones.
+        uint16* buffer_slots = nullptr;
+
+        uint16 num_active_buffers = 0;
+
+        bool activating_triangles = false;
+
+        // Clip half of the record being activated, the other half has a record of its own.
+        uint8 activating_clip_half = 0;
+
+        // Scanlines covered by the stored rasterization data.
+        int32 slab_start = 0;
+
+        int32 slab_end = 0;
+
+        uint16 num_slabs = 0;
+
+        uint32 num_overflows = 0;
+
         uint16 max_num_buffers = 0;
 
         uint16 num_buffers = 0;
@@ -110,13 +241,105 @@ public:
 
         uint16 actives_order_stop = 0;
 
-        // int16 num_scanlines_per_bucket = 1; POSSIBLE_FEATURE: rendering scanlines in buckets
+        int16 num_scanlines_per_bucket = 1;
 
         uint16 instance_idx_marker = 0;
 
         int32 next_scanline = 0;
+
+        int32 bucket_start_scanline = 0;
     };
     using RenderData = std::conditional_t<t_cfg.render_mode == SCANLINE, ScanlineRenderData, std::monostate>;
+    static constexpr uint32 TILE_BIN_END = 0xFFFFFFFF;
+    static constexpr uint16 VISIBILITY_NONE = 0xFFFF;
+    struct TileBin
+    {
+        uint32 first_entry;
+        uint32 last_entry;
+    };
+    struct TileBinEntry
+    {
+        uint16 buffer_idx;
+        uint32 next_entry;
+    };
+    struct TiledRenderData
+    {
+        RasterizationBuffer* buffers = nullptr;
+
+        TileBin* bins = nullptr;
+
+        TileBinEntry* entries = nullptr;
+
+        uint16 max_num_buffers = 0;
+
+        uint16 num_buffers = 0;
+
+        uint32 max_num_entries = 0;
+
+        uint32 num_entries = 0;
+
+        int32 num_tiles_x = 0;
+
+        int32 num_tiles_y = 0;
+
+        uint16 instance_idx_marker = 0;
+
+        int32 tile_x_min = 0;
+
+        int32 tile_x_max = 0;
+
+        int32 tile_y_min = 0;
+
+        int32 tile_y_max = 0;
+
+        // Rasterization buffer index of the visible triangle per pixel of the current tile, for deferred shading.
+        uint16* visibility = nullptr;
+
+        uint16 current_buffer_idx = 0;
+
+#ifdef MICRORENDERER_MULTITHREADING
+        TileScheduler* scheduler = nullptr;
+#endif
+    };
+    using TiledData = std::conditional_t<t_cfg.render_mode == TILED, TiledRenderData, std::monostate>;
+    // Edge length in pixels of the square depthbuffer blocks used for hierarchical depth.
+    static constexpr int32 depth_block_size = 8;
+    struct DepthBlock
+    {
+        // Conservative minimum of the block's stored depths, exact unless dirty.
+        T min_depth;
+        // Set when a depth inside the block was written since min_depth was computed.
+        bool dirty;
+    };
+    struct HierarchicalDepthData
+    {
+        DepthBlock* blocks = nullptr;
+
+        int32 num_blocks_x = 0;
+    };
+    using HierarchicalDepth = std::conditional_t<t_cfg.hierarchical_depth == HIERARCHICAL_DEPTH_ENABLED, HierarchicalDepthData, std::monostate>;
+    // Part of the current scanline span between two divisions of perspective-corrected attributes.
+    struct PerspectiveSpanData
+    {
+        // Span of the triangle on the current scanline, not clipped to the screen or tile.
+        int32 scanline_x_start;
+
+        int32 scanline_x_stop;
+
+        // Pixels of the part, invalid if x_start > x_stop.
+        int32 x_start;
+
+        int32 x_stop;
+
+        // Pixel of the attributes in end, the one after x_stop unless clamped to the scanline span. -1 if invalid.
+        int32 x_end;
+
+        // Divided attributes at x_start with increments in x to those at x_end.
+        TriangleBuffer start;
+
+        TriangleBuffer end;
+    };
+    using PerspectiveData = std::conditional_t<perspective_correction, PerspectiveSpanData, std::monostate>;
 
     Renderer() = default;
 
@@ -124,9 +347,15 @@ public:
 
     Framebuffer& getFramebuffer() requires(t_cfg.shader_cfg.shading == SHADING_ENABLED);
 
-    void setDepthbuffer(void* address) requires(t_cfg.shader_cfg.depth_test == DEPTH_TEST_ENABLED);
+    void setDepthbuffer(void* address) requires(t_cfg.shader_cfg.depth_test == DEPTH_TEST_ENABLED && t_cfg.render_mode != TILED);
 
-    Depthbuffer& getDepthbuffer() requires(t_cfg.shader_cfg.depth_test == DEPTH_TEST_ENABLED);
+    Depthbuffer& getDepthbuffer() requires(t_cfg.shader_cfg.depth_test == DEPTH_TEST_ENABLED && t_cfg.render_mode != TILED);
+
+    // Blocks must hold getNumDepthBlocks() elements. They are reset with every render() call, which assumes all
+    // stored depths are at least 0, e.g. after clearing the depthbuffer to 0.
+    void setDepthBlocks(DepthBlock* blocks) requires(t_cfg.hierarchical_depth == HIERARCHICAL_DEPTH_ENABLED && t_cfg.render_mode == FRAMEBUFFER);
+
+    uint32 getNumDepthBlocks() const requires(t_cfg.hierarchical_depth == HIERARCHICAL_DEPTH_ENABLED && t_cfg.render_mode == FRAMEBUFFER);
 
     void setResolution(int32 width, int32 height);
 
@@ -142,7 +371,53 @@ public:
 
     void setVertexBuffers(VertexBuffer* buffers);
 
-    void setRasterizationBuffers(RasterizationBuffer* buffers, RasterizationOrder* order, uint16 size_in_elements) requires(t_cfg.render_mode == SCANLINE);
+    void setRasterizationBuffers(RasterizationBuffer* buffers, RasterizationOrder* order, uint16 size_in_elements)
+        requires(t_cfg.render_mode == SCANLINE && t_cfg.deferred_setup == DEFERRED_SETUP_DISABLED);
+
+    // Records and order hold one element per triangle, or per half of a triangle clipped into two, buffers and slots
+    // one per simultaneously active triangle.
+    void setTriangleRecords(TriangleRecord* records, RasterizationOrder* order, uint16 size_in_elements)
+        requires(t_cfg.deferred_setup == DEFERRED_SETUP_ENABLED);
+
+    void setRasterizationBuffers(RasterizationBuffer* buffers, uint16* slots, uint16 size_in_elements)
+        requires(t_cfg.deferred_setup == DEFERRED_SETUP_ENABLED);
+
+    // Histogram must hold height + 1 elements. If set, the rasterization order is sorted by counting start scanlines in
+    // O(triangles + height), keeping triangles starting on the same scanline in processing order.
+    void setRasterizationHistogram(uint16* histogram) requires(t_cfg.render_mode == SCANLINE);
+
+    // Number of triangles that did not fit into the rasterization buffers (or triangle records) during the current frame.
+    // Each overflow ends the current slab of scanlines early, so that the triangle is processed again for the next
+    // slab. Triangles only get lost if they do not fit although the slab starts at their start scanline.
+    uint32 getNumOverflows() const requires(t_cfg.render_mode == SCANLINE);
+
+    // Number of passes over the scene's geometry during the current frame.
+    uint16 getNumSlabs() const requires(t_cfg.render_mode == SCANLINE);
+
+    // Frame- and depthbuffer hold this number of scanlines, which are shaded at once by renderNextScanlineBand().
+    void setScanlinesPerBucket(int16 number) requires(t_cfg.render_mode == SCANLINE);
+
+    void setRasterizationBuffers(RasterizationBuffer* buffers, uint16 size_in_elements) requires(t_cfg.render_mode == TILED);
+
+    // Bins must hold getNumTiles() elements, entries are shared by all bins.
+    void setTileBins(TileBin* bins, TileBinEntry* entries, uint32 num_entries) requires(t_cfg.render_mode == TILED);
+
+    uint32 getNumTiles() const requires(t_cfg.render_mode == TILED);
+
+#ifdef MICRORENDERER_MULTITHREADING
+    // Tiles are shaded on all threads of the scheduler, or serially if nullptr. Output is identical in both cases.
+    void setTileScheduler(TileScheduler* scheduler) requires(t_cfg.render_mode == TILED);
+#endif
+
+#ifdef MICRORENDERER_STATISTICS
+    // Counters of the last render() call, including scanlines rendered since.
+    const RenderStatistics& getStatistics() const;
+#endif
+
+#ifdef MICRORENDERER_TRACE
+    // Stages of frames in the trace's capture range are recorded, or none if nullptr.
+    void setTrace(RenderTrace* trace);
+#endif
 
     //void rasterizeLineDDASafe(T x0, T y0, T x1, T y1, const Vector3<T> &color);
     //void rasterizeLineDDAUnsafe(T x0, T y0, T x1, T y1, const Vector3<T> &color);
@@ -151,11 +426,75 @@ public:
 
     void renderNextScanline() requires(t_cfg.render_mode == SCANLINE);
 
+    void renderNextScanlineBand() requires(t_cfg.render_mode == SCANLINE);
+
 private:
+#ifdef MICRORENDERER_KERNEL_BENCHMARK
+    // Calls rasterization kernels in isolation, see benchmark/kernel_benchmark.cpp.
+    friend struct RendererKernels;
+#endif
+
+    void renderScanlines(int32 num_scanlines) requires(t_cfg.render_mode == SCANLINE);
+
+    void processInstances();
+
+    // Returns whether the model's bounding box certainly lies outside the screen or behind the near plane under the
+    // instance's model_screen_tf. Instances without either are never culled.
+    bool isInstanceCulled(const InstanceData& instance, const ModelData* model) const;
+
+    // Returns whether all corners of the box lie outside the same screen border or behind the near plane.
+    bool isBoxCulled(const Matrix4<T>& model_screen_tf, const ModelBounds<T>& bounds) const;
+
+    // Returns a view vector g and scale w (as g, w) of the instance's model space, such that triangles with normal n
+    // through point p have a screen space area of the same sign as dot(n, g + w * p) in front of the camera.
+    Vector4<T> computeModelViewVector(const Matrix4<T>& model_screen_tf) const;
+
+    // Returns whether a cluster of triangles is certainly off screen, behind the near plane or back-facing.
+    bool isClusterCulled(const Matrix4<T>& model_screen_tf, const Vector4<T>& view, const ModelCluster<T>& cluster) const;
+
+    // Processes the scene's geometry again and stores rasterization data for scanlines from first_scanline on, until
+    // the rasterization buffers are full.
+    void processSlab(int32 first_scanline) requires(t_cfg.render_mode == SCANLINE);
+
+    // Returns whether a triangle certainly has no scanline inside the current slab and computes its start scanline.
+    bool isOutsideSlab(const VertexData& v1, const VertexData& v2, const VertexData& v3, int32& start_scanline)
+        requires(t_cfg.render_mode == SCANLINE);
+
+    // Advances a set up triangle starting above the current slab to the slab. Returns false if it does not cover the slab.
+    bool advanceToSlab(RasterizationBuffer& rasterization, int32& start_scanline) requires(t_cfg.render_mode == SCANLINE);
+
+    void shadeActiveTriangles(int32 first_scanline, int32 last_scanline) requires(t_cfg.render_mode == SCANLINE);
+
+    // Shades scanlines of an active triangle and returns whether the triangle has ended.
+    bool shadeScanlinesOfTriangle(RasterizationBuffer& rasterization, int32 first_scanline, int32 last_scanline)
+        requires(t_cfg.render_mode == SCANLINE);
+
+    void sortRasterizationOrder() requires(t_cfg.render_mode == SCANLINE);
+
+    // Activates triangles starting until last_scanline, ending the slab early if buffers run out.
+    void activateTriangles(int32 first_scanline, int32 last_scanline) requires(t_cfg.deferred_setup == DEFERRED_SETUP_ENABLED);
+
+    void activateTriangle(const TriangleRecord& record) requires(t_cfg.deferred_setup == DEFERRED_SETUP_ENABLED);
+
     void processVertices(const ModelData* model);
 
+    void processVertex(const VertexData& vertex);
+
+    // Amount to add to statistics of vertex processing, culling and clipping. Deferred setup processes the vertices
+    // and triangle of a record again when activating it, which must not count them twice.
+    uint32 getGeometryCount(uint32 amount) const;
+
+    // Shades and homogenizes vertex_batch_size consecutive vertices at once.
+    void processVertexBatch(const VertexSource* sources, VertexBuffer* buffers)
+        requires(ShaderProgram_type::batched_vertex_shading && std::is_floating_point_v<T>);
+
+    // Culls and clips all triangles of an instance, skipping rejected clusters if the model has any.
+    void cullAndClipTriangles(const InstanceData& instance, const ModelData* model);
+
     void cullAndClipTriangle(const ModelData* model, uint32 tri_idx);
 
+    void cullAndClipTriangle(uint32 tri_idx, const VertexData (&vertices)[3]);
+
     bool setupTriangleRasterization(uint32 tri_idx, const VertexData& v1, const VertexData& v2, const VertexData& v3,
                                     RasterizationBuffer& rasterization, int32& start_scanline);
 
@@ -164,9 +503,76 @@ private:
 
     void shadeScanlineOfTriangle(RasterizationBuffer& rasterization, int32 scanline);
 
+    // Interpolates the attributes needed during rasterization, which is only depth when shading is deferred, or in x
+    // with lazy attributes.
+    template<IncrementationMode mode>
+    void interpolateRasterization(TriangleBuffer* triangle, int32 offset = 1);
+
+    // Shades pixels x_start to x_stop, leaving the triangle's attributes at x_stop + 1. Returns whether any pixel passed
+    // the depth test.
+    bool shadeDepthTestedSpan(RasterizationBuffer& rasterization, int32 x_start, int32 x_stop, int32 scanline)
+        requires(t_cfg.shader_cfg.depth_test == DEPTH_TEST_ENABLED);
+
+    // Whether the rasterization's triangle has attributes constant along scanlines, as decided at setup.
+    static bool isFlat(const RasterizationBuffer& rasterization);
+
+    // Depth-tests pixels x_start to x_stop of a triangle with attributes constant along scanlines and fills passing
+    // pixels with one color, computed at the first that passes. Leaves the triangle's attributes at x_stop + 1, returns
+    // whether any passed.
+    bool shadeFlatSpan(RasterizationBuffer& rasterization, int32 x_start, int32 x_stop, int32 scanline)
+        requires(flat_spans);
+
+    // Shades a span block by block, skipping blocks the span is entirely behind. Leaves attributes at x_stop + 1.
+    void shadeSpanInDepthBlocks(RasterizationBuffer& rasterization, int32 x_start, int32 x_stop, int32 scanline)
+        requires(t_cfg.hierarchical_depth == HIERARCHICAL_DEPTH_ENABLED);
+
+    DepthBlock& getDepthBlock(int32 x, int32 y) requires(t_cfg.hierarchical_depth == HIERARCHICAL_DEPTH_ENABLED);
+
+    // Recomputes the minimum depth of dirty blocks inside the frame or current tile.
+    void refreshDepthBlocks() requires(t_cfg.hierarchical_depth == HIERARCHICAL_DEPTH_ENABLED);
+
+    ShaderOutput computeColor(TriangleBuffer* triangle) requires(t_cfg.shader_cfg.shading == SHADING_ENABLED);
+
+    // Triangle buffer with the attributes at pixel x of the current scanline, which is the rasterization's own unless
+    // attributes are lazy or perspective-corrected. Then only the shader's attributes are evaluated at x in the given
+    // fragment buffer, along with their increments in x for span shading.
+    TriangleBuffer* getAttributesAt(RasterizationBuffer& rasterization, int32 x, TriangleBuffer& fragment);
+
+    // Divides the attributes at the start and end of the part of the current scanline span containing x, and sets
+    // their increments in x to interpolate linearly in between.
+    void updatePerspectiveSpan(RasterizationBuffer& rasterization, int32 x) requires(perspective_correction);
+
+    // Evaluates the attributes divided by w and 1 / w at x of the current scanline and divides the former by the latter.
+    void computePerspectiveAttributes(const RasterizationBuffer& rasterization, int32 x, TriangleBuffer& fragment)
+        requires(perspective_correction);
+
+    // Computes the colors of up to color_span_size pixels from x on at once and draws those in the mask. Leaves the
+    // framebuffer position and the triangle's attributes at the pixel after the span.
+    template<typename BufferPosition>
+    void shadeColorSpan(RasterizationBuffer& rasterization, int32 x, BufferPosition& framebuffer_position, int32 length,
+                        uint32 mask)
+        requires(span_shading);
+
     void shadeFullTriangle(RasterizationBuffer& rasterization, int32 start_scanline);
 
-    void processTriangle(uint32 tri_idx, VertexData v1, VertexData v2, VertexData v3);
+    void advanceTriangleRasterization(RasterizationBuffer& rasterization, int32 from_scanline, int32 to_scanline);
+
+    void shadeTile(uint32 tile_idx) requires(t_cfg.render_mode == TILED);
+
+    // Runs the fragment shader on every pixel of the current tile that holds a visible triangle.
+    void shadeVisibleTriangles() requires(t_cfg.deferred_shading == DEFERRED_SHADING_ENABLED);
+
+    // Clip half tells both triangles resulting from clipping apart, it is 0 if the triangle is not split.
+    void processTriangle(uint32 tri_idx, VertexData v1, VertexData v2, VertexData v3, uint8 clip_half = 0);
+
+    bool binTriangle(const RasterizationBuffer& rasterization, uint16 buffer_idx, const VertexData& v1,
+                     const VertexData& v2, const VertexData& v3) requires(t_cfg.render_mode == TILED);
+
+#ifdef MICRORENDERER_SIMD
+    static constexpr bool simd_depth_test = t_cfg.shader_cfg.depth_test == DEPTH_TEST_ENABLED && depth_test_lanes<T> > 1;
+#else
+    static constexpr bool simd_depth_test = false;
+#endif
 
     Framebuffer framebuffer;
 
@@ -193,6 +599,20 @@ private:
     VertexBuffer* vertex_buffers = nullptr;
 
     RenderData scanline_render_data;
+
+    TiledData tiled_render_data;
+
+    HierarchicalDepth hierarchical_depth_data;
+
+    PerspectiveData perspective_span;
+
+#ifdef MICRORENDERER_STATISTICS
+    RenderStatistics statistics;
+#endif
+
+#ifdef MICRORENDERER_TRACE
+    RenderTrace* trace = nullptr;
+#endif
 };
 
 } // namespace MicroRenderer
@@ -5,6 +5,7 @@
 #pragma once
 #include "Renderer.h"
 #include <algorithm>
+#include <bit>
 #include <cmath>
 #include <functional>
 #include "MicroRenderer/Math/Vector2.h"
@@ -25,34 +26,68 @@ typename Renderer<T, t_cfg, ShaderProgram>::Framebuffer& Renderer<T, t_cfg, Shad
 }
 
 template<typename T, RendererConfiguration t_cfg, template <typename, ShaderConfiguration> class ShaderProgram>
-void Renderer<T, t_cfg, ShaderProgram>::setDepthbuffer(void* address) requires(t_cfg.shader_cfg.depth_test == DEPTH_TEST_ENABLED)
+void Renderer<T, t_cfg, ShaderProgram>::setDepthbuffer(void* address) requires(t_cfg.shader_cfg.depth_test == DEPTH_TEST_ENABLED && t_cfg.render_mode != TILED)
 {
     depthbuffer.setBuffer(address);
 }
 
 template<typename T, RendererConfiguration t_cfg, template <typename, ShaderConfiguration> class ShaderProgram>
-typename Renderer<T, t_cfg, ShaderProgram>::Depthbuffer& Renderer<T, t_cfg, ShaderProgram>::getDepthbuffer() requires(t_cfg.shader_cfg.depth_test == DEPTH_TEST_ENABLED)
+typename Renderer<T, t_cfg, ShaderProgram>::Depthbuffer& Renderer<T, t_cfg, ShaderProgram>::getDepthbuffer() requires(t_cfg.shader_cfg.depth_test == DEPTH_TEST_ENABLED && t_cfg.render_mode != TILED)
 {
     return depthbuffer;
 }
 
+template<typename T, RendererConfiguration t_cfg, template <typename, ShaderConfiguration> class ShaderProgram>
+void Renderer<T, t_cfg, ShaderProgram>::setDepthBlocks(DepthBlock* blocks) requires(t_cfg.hierarchical_depth == HIERARCHICAL_DEPTH_ENABLED && t_cfg.render_mode == FRAMEBUFFER)
+{
+    hierarchical_depth_data.blocks = blocks;
+}
+
+template<typename T, RendererConfiguration t_cfg, template <typename, ShaderConfiguration> class ShaderProgram>
+uint32 Renderer<T, t_cfg, ShaderProgram>::getNumDepthBlocks() const requires(t_cfg.hierarchical_depth == HIERARCHICAL_DEPTH_ENABLED && t_cfg.render_mode == FRAMEBUFFER)
+{
+    const int32 num_blocks_y = (height_minus_one + depth_block_size) / depth_block_size;
+    return static_cast<uint32>(hierarchical_depth_data.num_blocks_x * num_blocks_y);
+}
+
 template<typename T, RendererConfiguration t_cfg, template <typename, ShaderConfiguration> class ShaderProgram>
 void Renderer<T, t_cfg, ShaderProgram>::setResolution(int32 width, int32 height)
 {
     assert(width >= 0 && height >= 0);
     int32 tex_height = 1;
-    if constexpr (t_cfg.render_mode == FRAMEBUFFER) {
+    if constexpr (t_cfg.render_mode == SCANLINE) {
+        tex_height = scanline_render_data.num_scanlines_per_bucket;
+    }
+    if constexpr (t_cfg.render_mode == FRAMEBUFFER || t_cfg.render_mode == TILED) {
         tex_height = height;
     }
     if constexpr (t_cfg.shader_cfg.shading == SHADING_ENABLED) {
         framebuffer.setResolution(width, tex_height);
     }
     if constexpr (t_cfg.shader_cfg.depth_test == DEPTH_TEST_ENABLED) {
-        depthbuffer.setResolution(width, tex_height);
+        if constexpr (t_cfg.render_mode == TILED) {
+            // Depthbuffer only covers a single tile.
+            depthbuffer.setResolution(tile_size, tile_size);
+        }
+        else {
+            depthbuffer.setResolution(width, tex_height);
+        }
     }
     width_minus_one = width - 1;
     height_minus_one = height - 1;
 
+    if constexpr (t_cfg.render_mode == TILED) {
+        // Compute number of tiles covering the screen.
+        tiled_render_data.num_tiles_x = (width + tile_size - 1) / tile_size;
+        tiled_render_data.num_tiles_y = (height + tile_size - 1) / tile_size;
+    }
+
+    if constexpr (t_cfg.hierarchical_depth == HIERARCHICAL_DEPTH_ENABLED) {
+        // Compute number of depth blocks per row of the depthbuffer.
+        const int32 depth_width = t_cfg.render_mode == TILED ? tile_size : width;
+        hierarchical_depth_data.num_blocks_x = (depth_width + depth_block_size - 1) / depth_block_size;
+    }
+
     // Compute clip screen borders.
     right_x_clip = static_cast<T>(-0.5) + static_cast<T>(width);
     top_y_clip = static_cast<T>(-0.5) + static_cast<T>(height);
@@ -99,13 +134,105 @@ void Renderer<T, t_cfg, ShaderProgram>::setVertexBuffers(VertexBuffer* buffers)
 }
 
 template<typename T, RendererConfiguration t_cfg, template <typename, ShaderConfiguration> class ShaderProgram>
-void Renderer<T, t_cfg, ShaderProgram>::setRasterizationBuffers(RasterizationBuffer* buffers, RasterizationOrder* order, uint16 size_in_elements) requires(t_cfg.render_mode == SCANLINE)
+void Renderer<T, t_cfg, ShaderProgram>::setRasterizationBuffers(RasterizationBuffer* buffers, RasterizationOrder* order, uint16 size_in_elements)
+    requires(t_cfg.render_mode == SCANLINE && t_cfg.deferred_setup == DEFERRED_SETUP_DISABLED)
 {
     scanline_render_data.buffers = buffers;
     scanline_render_data.order = order;
     scanline_render_data.max_num_buffers = size_in_elements;
 }
 
+template<typename T, RendererConfiguration t_cfg, template <typename, ShaderConfiguration> class ShaderProgram>
+void Renderer<T, t_cfg, ShaderProgram>::setTriangleRecords(TriangleRecord* records, RasterizationOrder* order, uint16 size_in_elements)
+    requires(t_cfg.deferred_setup == DEFERRED_SETUP_ENABLED)
+{
+    scanline_render_data.records = records;
+    scanline_render_data.order = order;
+    scanline_render_data.max_num_records = size_in_elements;
+}
+
+template<typename T, RendererConfiguration t_cfg, template <typename, ShaderConfiguration> class ShaderProgram>
+void Renderer<T, t_cfg, ShaderProgram>::setRasterizationBuffers(RasterizationBuffer* buffers, uint16* slots, uint16 size_in_elements)
+    requires(t_cfg.deferred_setup == DEFERRED_SETUP_ENABLED)
+{
+    scanline_render_data.buffers = buffers;
+    scanline_render_data.buffer_slots = slots;
+    scanline_render_data.max_num_buffers = size_in_elements;
+}
+
+template<typename T, RendererConfiguration t_cfg, template <typename, ShaderConfiguration> class ShaderProgram>
+uint32 Renderer<T, t_cfg, ShaderProgram>::getNumOverflows() const requires(t_cfg.render_mode == SCANLINE)
+{
+    return scanline_render_data.num_overflows;
+}
+
+template<typename T, RendererConfiguration t_cfg, template <typename, ShaderConfiguration> class ShaderProgram>
+uint16 Renderer<T, t_cfg, ShaderProgram>::getNumSlabs() const requires(t_cfg.render_mode == SCANLINE)
+{
+    return scanline_render_data.num_slabs;
+}
+
+template<typename T, RendererConfiguration t_cfg, template <typename, ShaderConfiguration> class ShaderProgram>
+void Renderer<T, t_cfg, ShaderProgram>::setRasterizationHistogram(uint16* histogram) requires(t_cfg.render_mode == SCANLINE)
+{
+    scanline_render_data.histogram = histogram;
+}
+
+template<typename T, RendererConfiguration t_cfg, template <typename, ShaderConfiguration> class ShaderProgram>
+void Renderer<T, t_cfg, ShaderProgram>::setScanlinesPerBucket(int16 number) requires(t_cfg.render_mode == SCANLINE)
+{
+    assert(number >= 1);
+    scanline_render_data.num_scanlines_per_bucket = number;
+
+    // Update frame/depthbuffer resolutions.
+    setResolution(width_minus_one + 1, height_minus_one + 1);
+}
+
+template<typename T, RendererConfiguration t_cfg, template <typename, ShaderConfiguration> class ShaderProgram>
+void Renderer<T, t_cfg, ShaderProgram>::setRasterizationBuffers(RasterizationBuffer* buffers, uint16 size_in_elements) requires(t_cfg.render_mode == TILED)
+{
+    tiled_render_data.buffers = buffers;
+    tiled_render_data.max_num_buffers = size_in_elements;
+}
+
+template<typename T, RendererConfiguration t_cfg, template <typename, ShaderConfiguration> class ShaderProgram>
+void Renderer<T, t_cfg, ShaderProgram>::setTileBins(TileBin* bins, TileBinEntry* entries, uint32 num_entries) requires(t_cfg.render_mode == TILED)
+{
+    tiled_render_data.bins = bins;
+    tiled_render_data.entries = entries;
+    tiled_render_data.max_num_entries = num_entries;
+}
+
+template<typename T, RendererConfiguration t_cfg, template <typename, ShaderConfiguration> class ShaderProgram>
+uint32 Renderer<T, t_cfg, ShaderProgram>::getNumTiles() const requires(t_cfg.render_mode == TILED)
+{
+    return static_cast<uint32>(tiled_render_data.num_tiles_x * tiled_render_data.num_tiles_y);
+}
+
+#ifdef MICRORENDERER_MULTITHREADING
+template<typename T, RendererConfiguration t_cfg, template <typename, ShaderConfiguration> class ShaderProgram>
+void Renderer<T, t_cfg, ShaderProgram>::setTileScheduler(TileScheduler* scheduler) requires(t_cfg.render_mode == TILED)
+{
+    tiled_render_data.scheduler = scheduler;
+}
+#endif
+
+#ifdef MICRORENDERER_STATISTICS
+template<typename T, RendererConfiguration t_cfg, template <typename, ShaderConfiguration> class ShaderProgram>
+const RenderStatistics& Renderer<T, t_cfg, ShaderProgram>::getStatistics() const
+{
+    return statistics;
+}
+#endif
+
+#ifdef MICRORENDERER_TRACE
+template<typename T, RendererConfiguration t_cfg, template <typename, ShaderConfiguration> class ShaderProgram>
+void Renderer<T, t_cfg, ShaderProgram>::setTrace(RenderTrace* trace)
+{
+    this->trace = trace;
+}
+#endif
+
 /*template<typename T, RendererConfiguration t_cfg, template <typename, ShaderConfiguration> class ShaderProgram>
 void Renderer<T, t_cfg, ShaderProgram>::rasterizeLineDDASafe(T x0, T y0, T x1, T y1, const Vector3<T>& color)
 {
@@ -127,14 +254,14 @@ void Renderer<T, t_cfg, ShaderProgram>::rasterizeLineDDAUnsafe(T x0, T y0, T x1,
     }
     const T dy = y1 - y0;
     const T dx = x1 - x0;
-    const T dx_abs = std::abs(dx);
+    const T dx_abs = abs(dx);
     if (dx_abs >= dy) {
         // Line moves in x faster than in y.
-        const auto x_start = static_cast<int32>(std::round(x0));
-        const auto x_end = static_cast<int32>(std::round(x1));
+        const auto x_start = static_cast<int32>(round(x0));
+        const auto x_end = static_cast<int32>(round(x1));
         const T y_step = dy / dx_abs;
         T y = y0;
-        T y_thresh = std::round(y);
+        T y_thresh = round(y);
         framebuffer.setCursor(x_start, static_cast<int32>(y_thresh));
         y_thresh += static_cast<T>(0.5);
         if (dx_abs == dx) {
@@ -164,11 +291,11 @@ void Renderer<T, t_cfg, ShaderProgram>::rasterizeLineDDAUnsafe(T x0, T y0, T x1,
     }
     else {
         // Line moves in x slower than in y.
-        const auto y_start = static_cast<int32>(std::round(y0));
-        const auto y_end = static_cast<int32>(std::round(y1));
+        const auto y_start = static_cast<int32>(round(y0));
+        const auto y_end = static_cast<int32>(round(y1));
         const T x_step = dx_abs / dy;
         T x = x0;
-        T x_thresh = std::round(x);
+        T x_thresh = round(x);
         framebuffer.setCursor(static_cast<int32>(x_thresh), y_start);
         if (dx == dx_abs) {
             // Line moves to the right.
@@ -202,19 +329,141 @@ void Renderer<T, t_cfg, ShaderProgram>::rasterizeLineDDAUnsafe(T x0, T y0, T x1,
 template<typename T, RendererConfiguration t_cfg, template <typename, ShaderConfiguration> class ShaderProgram>
 void Renderer<T, t_cfg, ShaderProgram>::render()
 {
+#ifdef MICRORENDERER_STATISTICS
+    statistics = {};
+#endif
+#ifdef MICRORENDERER_TRACE
+    if (trace != nullptr) {
+        trace->beginFrame();
+    }
+#endif
+    MICRORENDERER_TRACE_SCOPE("render");
+
     if constexpr (t_cfg.render_mode == SCANLINE) {
-        // Reset scanline render data.
-        scanline_render_data.num_buffers = 0;
-        scanline_render_data.actives_order_start = 0;
-        scanline_render_data.actives_order_stop = 0;
+        // Reset frame and process geometry of the first slab. Following slabs are processed once scanline rendering
+        // reaches them.
         scanline_render_data.next_scanline = 0;
+        scanline_render_data.num_overflows = 0;
+        scanline_render_data.num_slabs = 0;
+        processSlab(0);
+        return;
+    }
+    else if constexpr (t_cfg.render_mode == TILED) {
+        // Reset tiled render data and empty all tile bins.
+        tiled_render_data.num_buffers = 0;
+        tiled_render_data.num_entries = 0;
+        const uint32 num_tiles = getNumTiles();
+        for (uint32 tile_idx = 0; tile_idx < num_tiles; ++tile_idx) {
+            tiled_render_data.bins[tile_idx].first_entry = TILE_BIN_END;
+        }
+    }
+
+    if constexpr (t_cfg.render_mode == FRAMEBUFFER && t_cfg.hierarchical_depth == HIERARCHICAL_DEPTH_ENABLED) {
+        // Reset depth blocks to the far plane, which is conservative for any depthbuffer contents >= 0.
+        assert(hierarchical_depth_data.blocks != nullptr);
+        std::fill_n(hierarchical_depth_data.blocks, getNumDepthBlocks(), DepthBlock{static_cast<T>(0.0), false});
+    }
+
+    processInstances();
+
+    if constexpr (t_cfg.render_mode == TILED) {
+        MICRORENDERER_TRACE_SCOPE("shadeTiles");
+        const uint32 num_tiles = getNumTiles();
+#ifdef MICRORENDERER_MULTITHREADING
+        // Two RGB444 pixels share a byte, so with an odd width neighbouring tiles would write the same byte from
+        // different threads. Such framebuffers are shaded serially.
+        const bool shared_bytes = framebuffer_cfg.format == FORMAT_RGB444 && (width_minus_one + 1) % 2 != 0;
+        if (tiled_render_data.scheduler && !shared_bytes) {
+            // Shade tiles in parallel. Every thread works on its own copy of the renderer, so that shader program
+            // (uniform data), tile bounds and tile depthbuffer are thread-local. Stored rasterization buffers are
+            // only read.
+            TileScheduler& scheduler = *tiled_render_data.scheduler;
+#ifdef MICRORENDERER_STATISTICS
+            std::mutex statistics_mutex;
+#endif
+            auto shadeTiles = [&, this](uint32 thread_idx) {
+                Renderer thread_renderer = *this;
+#ifdef MICRORENDERER_STATISTICS
+                thread_renderer.statistics = {};
+#endif
+                uint32 tile_idx;
+                while (scheduler.acquireTile(thread_idx, tile_idx)) {
+                    thread_renderer.shadeTile(tile_idx);
+                }
+#ifdef MICRORENDERER_STATISTICS
+                // Add counters of thread to the renderer's.
+                std::lock_guard<std::mutex> lock(statistics_mutex);
+                statistics.merge(thread_renderer.statistics);
+#endif
+            };
+            scheduler.execute(num_tiles, shadeTiles);
+            return;
+        }
+#endif
+
+        // Shade tile by tile.
+        for (uint32 tile_idx = 0; tile_idx < num_tiles; ++tile_idx) {
+            shadeTile(tile_idx);
+        }
+    }
+}
+
+template <typename T, RendererConfiguration t_cfg, template <typename, ShaderConfiguration> class ShaderProgram>
+void Renderer<T, t_cfg, ShaderProgram>::sortRasterizationOrder() requires (t_cfg.render_mode == SCANLINE)
+{
+    MICRORENDERER_TRACE_SCOPE("sortRasterizationOrder");
+    ScanlineRenderData& data = scanline_render_data;
+    const int32 num_scanlines = height_minus_one + 1;
+
+    // Sort rasterization buffers, or triangle records if setup is deferred.
+    uint16 num_entries = data.num_buffers;
+    if constexpr (t_cfg.deferred_setup == DEFERRED_SETUP_ENABLED) {
+        num_entries = data.num_records;
+    }
+    auto getStartScanline = [&data](uint16 idx) {
+        if constexpr (t_cfg.deferred_setup == DEFERRED_SETUP_ENABLED) {
+            return data.records[idx].start_scanline;
+        }
+        else {
+            return data.buffers[idx].start_scanline;
+        }
+    };
+
+    // Triangles starting below the screen are never shaded and share the last scanline's bucket.
+    auto getBucket = [this](int16 scanline) {
+        return std::min(static_cast<int32>(scanline), height_minus_one);
+    };
+
+    // Count triangles per start scanline, shifted by one so that the prefix sum yields first positions.
+    std::fill_n(data.histogram, num_scanlines + 1, static_cast<uint16>(0));
+    for (uint16 idx = 0; idx < num_entries; ++idx) {
+        ++data.histogram[getBucket(getStartScanline(idx)) + 1];
+    }
+    for (int32 scanline = 1; scanline <= num_scanlines; ++scanline) {
+        data.histogram[scanline] += data.histogram[scanline - 1];
     }
 
+    // Place triangles at the next free position of their start scanline.
+    for (uint16 idx = 0; idx < num_entries; ++idx) {
+        const int16 scanline = getStartScanline(idx);
+        data.order[data.histogram[getBucket(scanline)]++] = {scanline, idx};
+    }
+}
+
+template <typename T, RendererConfiguration t_cfg, template <typename, ShaderConfiguration> class ShaderProgram>
+void Renderer<T, t_cfg, ShaderProgram>::processInstances()
+{
     // Process instances sequentially.
     for (uint16 instance_idx = 0; instance_idx < num_instances; ++instance_idx) {
         // Get model data.
         const ModelData* model = models + instances[instance_idx].model_idx;
 
+        // Skip instances that are certainly invisible before shading their vertices.
+        if (isInstanceCulled(instances[instance_idx], model)) {
+            MICRORENDERER_COUNT(instances_culled, 1);
+            continue;
+        }
+
         // Set instance data.
         shader_program.setInstanceData(instances + instance_idx);
 
@@ -225,132 +474,560 @@ void Renderer<T, t_cfg, ShaderProgram>::render()
             // Temporarily store instance reference for later storage in rasterization buffers.
             scanline_render_data.instance_idx_marker = instance_idx;
         }
+        else if constexpr (t_cfg.render_mode == TILED) {
+            // Temporarily store instance reference for later storage in rasterization buffers.
+            tiled_render_data.instance_idx_marker = instance_idx;
+        }
 
         // Process triangles.
         // Shading mode 'Framebuffer' shades here.
         // Shading mode 'SCANLINE' stores rasterization buffers for later line-by-line rasterization.
-        for (uint32 tri_idx = 0; tri_idx < static_cast<uint32>(model->num_triangles); ++tri_idx) {
-            cullAndClipTriangle(model, tri_idx);
+        // Shading mode 'TILED' stores rasterization buffers and bins them into screen tiles for later shading.
+        {
+            MICRORENDERER_TRACE_SCOPE_ARG("cullAndClipTriangles", "instance", instance_idx);
+            cullAndClipTriangles(instances[instance_idx], model);
+        }
+
+        if constexpr (t_cfg.render_mode == FRAMEBUFFER && t_cfg.hierarchical_depth == HIERARCHICAL_DEPTH_ENABLED) {
+            // Let following instances be rejected against this one.
+            refreshDepthBlocks();
+        }
+    }
+}
+
+template <typename T, RendererConfiguration t_cfg, template <typename, ShaderConfiguration> class ShaderProgram>
+void Renderer<T, t_cfg, ShaderProgram>::processSlab(int32 first_scanline) requires (t_cfg.render_mode == SCANLINE)
+{
+    MICRORENDERER_TRACE_SCOPE_ARG("processSlab", "first_scanline", first_scanline);
+    ScanlineRenderData& data = scanline_render_data;
+
+    // Reset stored rasterization data.
+    data.num_buffers = 0;
+    data.actives_order_start = 0;
+    data.actives_order_stop = 0;
+    if constexpr (t_cfg.deferred_setup == DEFERRED_SETUP_ENABLED) {
+        // Reset triangle records and free all rasterization buffers.
+        data.num_records = 0;
+        data.num_active_buffers = 0;
+        for (uint16 buffer_idx = 0; buffer_idx < data.max_num_buffers; ++buffer_idx) {
+            data.buffer_slots[buffer_idx] = buffer_idx;
         }
     }
 
-    if constexpr (t_cfg.render_mode == SCANLINE) {
-        // Sort rasterization buffers in y via the rasterization order.
-        std::sort(scanline_render_data.order, scanline_render_data.order + scanline_render_data.num_buffers);
+    // Slab covers the remaining screen until a triangle does not fit into the buffers.
+    data.slab_start = first_scanline;
+    data.slab_end = height_minus_one;
+    ++data.num_slabs;
+
+    processInstances();
+
+    // Sort rasterization buffers (or triangle records) in y via the rasterization order.
+    if (data.histogram) {
+        sortRasterizationOrder();
+    }
+    else {
+        MICRORENDERER_TRACE_SCOPE("sortRasterizationOrder");
+        uint16 num_entries = data.num_buffers;
+        if constexpr (t_cfg.deferred_setup == DEFERRED_SETUP_ENABLED) {
+            num_entries = data.num_records;
+        }
+        std::sort(data.order, data.order + num_entries);
+    }
+}
+
+template <typename T, RendererConfiguration t_cfg, template <typename, ShaderConfiguration> class ShaderProgram>
+bool Renderer<T, t_cfg, ShaderProgram>::isOutsideSlab(const VertexData& v1, const VertexData& v2, const VertexData& v3,
+                                                   int32& start_scanline) requires (t_cfg.render_mode == SCANLINE)
+{
+    // Compute scanline range like setupTriangleRasterization() does.
+    const T y_1 = v1.buffer->screen_position.y;
+    const T y_2 = v2.buffer->screen_position.y;
+    const T y_3 = v3.buffer->screen_position.y;
+    start_scanline = std::max(static_cast<int32>(ceil(std::min({y_1, y_2, y_3}))), 0);
+    const int32 end_scanline = static_cast<int32>(floor(std::max({y_1, y_2, y_3})));
+    return start_scanline > scanline_render_data.slab_end || end_scanline < scanline_render_data.slab_start;
+}
+
+template <typename T, RendererConfiguration t_cfg, template <typename, ShaderConfiguration> class ShaderProgram>
+bool Renderer<T, t_cfg, ShaderProgram>::advanceToSlab(RasterizationBuffer& rasterization, int32& start_scanline)
+    requires (t_cfg.render_mode == SCANLINE)
+{
+    const int32 slab_start = scanline_render_data.slab_start;
+    if (start_scanline > scanline_render_data.slab_end || static_cast<int32>(rasterization.y_fulltri_end) < slab_start) {
+        return false;
+    }
+    if (start_scanline < slab_start) {
+        // Triangle started in a previous slab.
+        advanceTriangleRasterization(rasterization, start_scanline, slab_start);
+        start_scanline = slab_start;
     }
+    return true;
 }
 
 template <typename T, RendererConfiguration t_cfg, template <typename, ShaderConfiguration> class ShaderProgram>
 void Renderer<T, t_cfg, ShaderProgram>::renderNextScanline() requires (t_cfg.render_mode == SCANLINE)
 {
-    ScanlineRenderData& data = scanline_render_data;
-    int32 scanline = scanline_render_data.next_scanline;
+    renderScanlines(1);
+}
+
+template <typename T, RendererConfiguration t_cfg, template <typename, ShaderConfiguration> class ShaderProgram>
+void Renderer<T, t_cfg, ShaderProgram>::renderNextScanlineBand() requires (t_cfg.render_mode == SCANLINE)
+{
+    renderScanlines(scanline_render_data.num_scanlines_per_bucket);
+}
 
-    // Add newly visible triangles to active section.
-    while (data.actives_order_stop < data.num_buffers) {
-        if (data.order[data.actives_order_stop].scanline == scanline) {
-            // Add next triangle to actives.
-            ++data.actives_order_stop;
+template <typename T, RendererConfiguration t_cfg, template <typename, ShaderConfiguration> class ShaderProgram>
+void Renderer<T, t_cfg, ShaderProgram>::renderScanlines(int32 num_scanlines) requires (t_cfg.render_mode == SCANLINE)
+{
+    ScanlineRenderData& data = scanline_render_data;
+    const int32 first_scanline = data.next_scanline;
+    const int32 last_scanline = std::min(first_scanline + num_scanlines - 1, height_minus_one);
+    MICRORENDERER_TRACE_SCOPE_ARG("renderScanlines", "first_scanline", first_scanline);
+    data.bucket_start_scanline = first_scanline;
+
+    // Shade bucket slab by slab, processing geometry again when a slab ends inside the bucket.
+    for (int32 from_scanline = first_scanline; from_scanline <= last_scanline;) {
+        if (from_scanline > data.slab_end) {
+            processSlab(from_scanline);
         }
-        else {
+        if constexpr (t_cfg.deferred_setup == DEFERRED_SETUP_ENABLED) {
+            activateTriangles(from_scanline, last_scanline);
+        }
+        const int32 to_scanline = std::min(last_scanline, data.slab_end);
+        shadeActiveTriangles(from_scanline, to_scanline);
+        from_scanline = to_scanline + 1;
+    }
+
+    // Advance scanline counter past bucket.
+    data.next_scanline = last_scanline + 1;
+}
+
+template <typename T, RendererConfiguration t_cfg, template <typename, ShaderConfiguration> class ShaderProgram>
+void Renderer<T, t_cfg, ShaderProgram>::activateTriangles(int32 first_scanline, int32 last_scanline)
+    requires (t_cfg.deferred_setup == DEFERRED_SETUP_ENABLED)
+{
+    // Set up newly visible triangles, adding their rasterization buffers to the active slots.
+    ScanlineRenderData& data = scanline_render_data;
+    data.activating_triangles = true;
+    while (data.actives_order_stop < data.num_records) {
+        const int32 start_scanline = data.order[data.actives_order_stop].scanline;
+        if (start_scanline > std::min(last_scanline, data.slab_end)) {
             break;
         }
+        const uint32 num_overflows = data.num_overflows;
+        activateTriangle(data.records[data.order[data.actives_order_stop].buffer_idx]);
+        if (data.num_overflows != num_overflows) {
+            if (start_scanline > first_scanline) {
+                // Out of buffers. End slab before the triangle, which is activated again for the next slab.
+                data.slab_end = start_scanline - 1;
+                break;
+            }
+            // The slab cannot end before the triangle. End it after the first scanline instead, so that the triangle
+            // is only lost there and activated again for the next slab, like render mode 'SCANLINE' does.
+            data.slab_end = first_scanline;
+            MICRORENDERER_COUNT(triangles_dropped, data.num_overflows - num_overflows);
+        }
+        ++data.actives_order_stop;
+    }
+    data.activating_triangles = false;
+}
+
+template <typename T, RendererConfiguration t_cfg, template <typename, ShaderConfiguration> class ShaderProgram>
+void Renderer<T, t_cfg, ShaderProgram>::shadeActiveTriangles(int32 first_scanline, int32 last_scanline) requires (t_cfg.render_mode == SCANLINE)
+{
+    ScanlineRenderData& data = scanline_render_data;
+    if constexpr (t_cfg.deferred_setup == DEFERRED_SETUP_ENABLED) {
+        // Shade all active triangles on all scanlines of the bucket.
+        MICRORENDERER_COUNT_PEAK(peak_active_triangles, data.num_active_buffers);
+        MICRORENDERER_TRACE_COUNTER("active_triangles", data.num_active_buffers);
+        uint16 slot = 0;
+        while (slot < data.num_active_buffers) {
+            RasterizationBuffer& rasterization = data.buffers[data.buffer_slots[slot]];
+
+            // Set instance data.
+            shader_program.setInstanceData(instances + rasterization.instance_idx);
+
+            // Clipped triangles of a record may start after the bucket.
+            const int32 start_scanline = std::max(static_cast<int32>(rasterization.start_scanline), first_scanline);
+            if (shadeScanlinesOfTriangle(rasterization, start_scanline, last_scanline)) {
+                // Triangle has ended. Free its buffer by swapping it behind the active slots, the last active slot
+                // takes its place and is shaded next.
+                --data.num_active_buffers;
+                std::swap(data.buffer_slots[slot], data.buffer_slots[data.num_active_buffers]);
+            }
+            else {
+                ++slot;
+            }
+        }
     }
+    else {
+        // Add newly visible triangles to active section.
+        while (data.actives_order_stop < data.num_buffers) {
+            if (static_cast<int32>(data.order[data.actives_order_stop].scanline) <= last_scanline) {
+                // Add next triangle to actives.
+                ++data.actives_order_stop;
+            }
+            else {
+                break;
+            }
+        }
 
-    // Shade all active triangles on scanline.
-    for (uint16 i = data.actives_order_start; i < data.actives_order_stop; ++i) {
-        RasterizationBuffer& rasterization = data.buffers[data.order[i].buffer_idx];
+        // Shade all active triangles on all scanlines of the bucket.
+        MICRORENDERER_COUNT_PEAK(peak_active_triangles, data.actives_order_stop - data.actives_order_start);
+        MICRORENDERER_TRACE_COUNTER("active_triangles", data.actives_order_stop - data.actives_order_start);
+        for (uint16 i = data.actives_order_start; i < data.actives_order_stop; ++i) {
+            RasterizationBuffer& rasterization = data.buffers[data.order[i].buffer_idx];
 
-        // Set instance data.
-        shader_program.setInstanceData(instances + rasterization.instance_idx);
+            // Set instance data.
+            shader_program.setInstanceData(instances + rasterization.instance_idx);
+
+            // Triangles becoming visible inside the bucket start at their first scanline.
+            const int32 start_scanline = std::max(static_cast<int32>(data.order[i].scanline), first_scanline);
+            if (shadeScanlinesOfTriangle(rasterization, start_scanline, last_scanline)) {
+                // Triangle has ended completely. Remove triangle from active section.
+                std::swap(data.order[i], data.order[data.actives_order_start]);
+                ++data.actives_order_start;
+            }
+        }
+    }
+}
 
+template<typename T, RendererConfiguration t_cfg, template <typename, ShaderConfiguration> class ShaderProgram>
+bool Renderer<T, t_cfg, ShaderProgram>::shadeScanlinesOfTriangle(RasterizationBuffer& rasterization, int32 first_scanline,
+                                                                 int32 last_scanline) requires(t_cfg.render_mode == SCANLINE)
+{
+    for (int32 scanline = first_scanline; scanline <= last_scanline; ++scanline) {
         // Shade triangle on scanline.
         shadeScanlineOfTriangle(rasterization, scanline);
 
         // Check if half-triangle has ended on this scanline.
         if (static_cast<int32>(rasterization.y_halftri_end) == scanline) {
             if (rasterization.y_halftri_end == rasterization.y_fulltri_end) {
-                // Triangle has ended completely. Remove triangle from active section.
-                std::swap(data.order[i], data.order[data.actives_order_start]);
-                ++data.actives_order_start;
+                // Triangle has ended completely.
+                return true;
+            }
+
+            // Adjust rasterization data for second half-triangle.
+            if (rasterization.last_is_left) {
+                // Left is middle.
+                rasterization.left_x = rasterization.last_x;
+                rasterization.left_dx_per_dy = rasterization.last_dx_per_dy;
+                // Right edge has already been advanced to next scanline by last shadeScanlineOfTriangle() call.
             }
             else {
-                // Adjust rasterization data for second half-triangle.
-                if (rasterization.last_is_left) {
-                    // Left is middle.
-                    rasterization.left_x = rasterization.last_x;
-                    rasterization.left_dx_per_dy = rasterization.last_dx_per_dy;
-                    // Right edge has already been advanced to next scanline by last shadeScanlineOfTriangle() call.
-                }
-                else {
-                    // Right is middle.
-                    rasterization.right_x = rasterization.last_x;
-                    rasterization.right_dx_per_dy = rasterization.last_dx_per_dy;
-                    // Left edge has already been advanced to next scanline by last shadeScanlineOfTriangle() call.
-                }
-                rasterization.y_halftri_end = rasterization.y_fulltri_end;
+                // Right is middle.
+                rasterization.right_x = rasterization.last_x;
+                rasterization.right_dx_per_dy = rasterization.last_dx_per_dy;
+                // Left edge has already been advanced to next scanline by last shadeScanlineOfTriangle() call.
             }
+            rasterization.y_halftri_end = rasterization.y_fulltri_end;
         }
     }
-
-    // Increment scanline counter.
-    ++scanline_render_data.next_scanline;
+    return false;
 }
 
 template<typename T, RendererConfiguration t_cfg, template <typename, ShaderConfiguration> class ShaderProgram>
-void Renderer<T, t_cfg, ShaderProgram>::processVertices(const ModelData* model)
+void Renderer<T, t_cfg, ShaderProgram>::activateTriangle(const TriangleRecord& record)
+    requires(t_cfg.deferred_setup == DEFERRED_SETUP_ENABLED)
 {
-    for (uint16 vertex_idx = 0; vertex_idx < model->num_vertices; ++vertex_idx) {
-        const VertexData vertex_data = {model->vertices + vertex_idx, vertex_buffers + vertex_idx};
+    const ModelData* model = models + instances[record.instance_idx].model_idx;
 
-        // Shade vertex.
-        shader_program.shadeVertex(vertex_data);
+    // Set instance data.
+    shader_program.setInstanceData(instances + record.instance_idx);
+    scanline_render_data.instance_idx_marker = record.instance_idx;
+    scanline_render_data.activating_clip_half = record.clip_half;
 
-        // Homogenize vertex.
-        if constexpr(t_cfg.shader_cfg.projection == PERSPECTIVE) {
-            vertex_data.buffer->homogenizeVertex(near_plane);
-        }
+    // Shade vertices again, since the vertex buffers have been reused by following instances. Statistics counted them
+    // when the triangle was recorded, see getGeometryCount.
+    const TriangleIndices& indices = model->indices[record.tri_idx];
+    VertexBuffer buffers[3];
+    const VertexData vertices[3] = {
+        {model->vertices + indices.vertex_1_idx, buffers},
+        {model->vertices + indices.vertex_2_idx, buffers + 1},
+        {model->vertices + indices.vertex_3_idx, buffers + 2}
+    };
+    for (const VertexData& vertex : vertices) {
+        processVertex(vertex);
     }
+
+    // Set up rasterization of the triangle, or of the record's half of it if clipping splits it.
+    cullAndClipTriangle(record.tri_idx, vertices);
 }
 
-template <typename T, RendererConfiguration t_cfg, template <typename, ShaderConfiguration> class ShaderProgram>
-void Renderer<T, t_cfg, ShaderProgram>::cullAndClipTriangle(const ModelData* model, uint32 tri_idx)
+template<typename T, RendererConfiguration t_cfg, template <typename, ShaderConfiguration> class ShaderProgram>
+bool Renderer<T, t_cfg, ShaderProgram>::isInstanceCulled(const InstanceData& instance, const ModelData* model) const
 {
-    // Gather vertex data.
-    const uint16 v1_idx = model->indices[tri_idx].vertex_1_idx;
-    const uint16 v2_idx = model->indices[tri_idx].vertex_2_idx;
-    const uint16 v3_idx = model->indices[tri_idx].vertex_3_idx;
-    const VertexData vertices[3] = {
-        {model->vertices + v1_idx, vertex_buffers + v1_idx},
-        {model->vertices + v2_idx, vertex_buffers + v2_idx},
-        {model->vertices + v3_idx, vertex_buffers + v3_idx}
-    };
-    const Vector3<T>& v1_screen_pos = vertices[0].buffer->screen_position;
-    const Vector3<T>& v2_screen_pos = vertices[1].buffer->screen_position;
-    const Vector3<T>& v3_screen_pos = vertices[2].buffer->screen_position;
+    if constexpr (requires { instance.model_screen_tf.transformPosition(Vector3<T>()); }) {
+        return model->bounds != nullptr && isBoxCulled(instance.model_screen_tf, *model->bounds);
+    }
+    else {
+        return false;
+    }
+}
 
-    // Backface culling and early degenerate check.
-    const Vector2<T> v1_to_v2 = {v2_screen_pos.x - v1_screen_pos.x, v2_screen_pos.y - v1_screen_pos.y};
-    const Vector2<T> v1_to_v3 = {v3_screen_pos.x - v1_screen_pos.x, v3_screen_pos.y - v1_screen_pos.y};
-    constexpr T DEGENERATE_THRESHOLD = static_cast<T>(0.001);
-    const T area = v1_to_v2.x * v1_to_v3.y - v1_to_v2.y * v1_to_v3.x;
-    if constexpr (t_cfg.front_face == COUNTERCLOCKWISE) {
-        if (area < DEGENERATE_THRESHOLD) // Counter-clockwise vertex order yields positive area.
-            return;
+template<typename T, RendererConfiguration t_cfg, template <typename, ShaderConfiguration> class ShaderProgram>
+bool Renderer<T, t_cfg, ShaderProgram>::isBoxCulled(const Matrix4<T>& model_screen_tf, const ModelBounds<T>& bounds) const
+{
+    constexpr bool cull_at_screen_border = t_cfg.shader_cfg.culling == CULL_AT_SCREEN_BORDER;
+    constexpr bool clip_at_near_plane = t_cfg.shader_cfg.clipping == CLIP_AT_NEAR_PLANE;
+    if constexpr (cull_at_screen_border || clip_at_near_plane) {
+        // Outcodes of the box's corners against the screen borders and the near plane, tested in clip space so
+        // that corners behind the camera are handled correctly. The box is culled if all corners are outside of
+        // the same plane.
+        uint8 common_outcode = 0b11111;
+        for (uint8 corner_idx = 0; corner_idx < 8; ++corner_idx) {
+            const Vector3<T> corner = {corner_idx & 1 ? bounds.max.x : bounds.min.x,
+                                       corner_idx & 2 ? bounds.max.y : bounds.min.y,
+                                       corner_idx & 4 ? bounds.max.z : bounds.min.z};
+            const Vector4<T> position = model_screen_tf.transformPosition(corner);
+            // Orthographic projection uses the transformed position as screen position directly.
+            const T w = t_cfg.shader_cfg.projection == PERSPECTIVE ? position.w : static_cast<T>(1.0);
+
+            uint8 outcode = 0;
+            if constexpr (cull_at_screen_border) {
+                outcode |= position.x < static_cast<T>(-0.5) * w ? 0b00001 : 0;
+                outcode |= position.x > right_x_clip * w ? 0b00010 : 0;
+                outcode |= position.y < static_cast<T>(-0.5) * w ? 0b00100 : 0;
+                outcode |= position.y > top_y_clip * w ? 0b01000 : 0;
+            }
+            if constexpr (clip_at_near_plane) {
+                outcode |= position.z < static_cast<T>(0.0) ? 0b10000 : 0;
+            }
+            common_outcode &= outcode;
+            if (common_outcode == 0) {
+                return false;
+            }
+        }
+        return true;
     }
     else {
-        if (area > DEGENERATE_THRESHOLD) // Clockwise vertex order yields negative area.
-            return;
+        return false;
     }
+}
 
-    // Lambda for computing the outcode of a vertex for Cohen-Sutherland clipping.
-    auto getCohenSutherlandOutcode = [right_x_clip = this->right_x_clip, top_y_clip = this->top_y_clip]
-                                     (const Vector3<T>& position) -> uint8
-    {
-        constexpr T left_x_clip = static_cast<T>(-0.5);
-        constexpr T bottom_y_clip = static_cast<T>(-0.5);
+template<typename T, RendererConfiguration t_cfg, template <typename, ShaderConfiguration> class ShaderProgram>
+Vector4<T> Renderer<T, t_cfg, ShaderProgram>::computeModelViewVector(const Matrix4<T>& model_screen_tf) const
+{
+    // Screen space areas are determinants of the vertices' (x, y, w) rows divided by the w's. By the Cauchy-Binet
+    // formula, the determinant is dot(n, g + w * p), with the cofactors of the rows' 3 x 4 matrix in g and w.
+    T rows[3][4];
+    for (uint8 col = 0; col < 4; ++col) {
+        rows[0][col] = model_screen_tf.columns[col].x;
+        rows[1][col] = model_screen_tf.columns[col].y;
+        if constexpr (t_cfg.shader_cfg.projection == PERSPECTIVE) {
+            rows[2][col] = model_screen_tf.columns[col].w;
+        }
+        else {
+            // Orthographic projection uses the transformed position as screen position directly, i.e. w = 1.
+            rows[2][col] = static_cast<T>(col == 3 ? 1.0 : 0.0);
+        }
+    }
 
-        constexpr uint8 OUTCODE_INSIDE = 0b0000;
+    // Scaling a row by a positive factor scales all cofactors alike, so rows are normalized to keep fixed-point
+    // products in range.
+    for (auto& row : rows) {
+        const T max_value = std::max(std::max(abs(row[0]), abs(row[1])), std::max(abs(row[2]), abs(row[3])));
+        if (max_value > static_cast<T>(0.0)) {
+            const T scale = static_cast<T>(1.0) / max_value;
+            for (T& value : row) {
+                value *= scale;
+            }
+        }
+    }
+
+    // Determinant of the rows without the given column.
+    auto getMinor = [&rows](uint8 skipped_col) -> T
+    {
+        const uint8 c0 = skipped_col == 0 ? 1 : 0;
+        const uint8 c1 = skipped_col <= 1 ? 2 : 1;
+        const uint8 c2 = skipped_col <= 2 ? 3 : 2;
+        return rows[0][c0] * (rows[1][c1] * rows[2][c2] - rows[1][c2] * rows[2][c1]) -
+               rows[0][c1] * (rows[1][c0] * rows[2][c2] - rows[1][c2] * rows[2][c0]) +
+               rows[0][c2] * (rows[1][c0] * rows[2][c1] - rows[1][c1] * rows[2][c0]);
+    };
+    return {getMinor(0), -getMinor(1), getMinor(2), getMinor(3)};
+}
+
+template<typename T, RendererConfiguration t_cfg, template <typename, ShaderConfiguration> class ShaderProgram>
+bool Renderer<T, t_cfg, ShaderProgram>::isClusterCulled(const Matrix4<T>& model_screen_tf, const Vector4<T>& view,
+                                                       const ModelCluster<T>& cluster) const
+{
+    if (cluster.cone_cos > static_cast<T>(0.0)) {
+        // All triangles are back-facing if dot(n, k) > |w * dot(n, p - center)| for all normals n in the cone and
+        // points p in the box, with k = -(g + w * center) for counter-clockwise front faces. The former is at least
+        // |k| * cos(phi + theta), with phi the angle between k and the cone's axis and theta the cone's angle, the
+        // latter at most |w| times the box's half extents summed up.
+        const Vector3<T> center = (cluster.bounds.min + cluster.bounds.max) * static_cast<T>(0.5);
+        const Vector3<T> extent = (cluster.bounds.max - cluster.bounds.min) * static_cast<T>(0.5);
+        Vector3<T> k = view.getXYZ() + center * view.w;
+        if constexpr (t_cfg.front_face == COUNTERCLOCKWISE) {
+            k = -k;
+        }
+        // |k| * cos(phi + theta) = dot(k, axis) * cos(theta) - |cross(k, axis)| * sin(theta), compared squared.
+        const T margin = k.dot(cluster.cone_axis) * cluster.cone_cos - abs(view.w) * (extent.x + extent.y + extent.z);
+        if (margin > static_cast<T>(0.0)) {
+            const Vector3<T> k_cross_axis = k.cross(cluster.cone_axis);
+            if (margin * margin > k_cross_axis.dot(k_cross_axis) * cluster.cone_sin * cluster.cone_sin) {
+                return true;
+            }
+        }
+    }
+    return isBoxCulled(model_screen_tf, cluster.bounds);
+}
+
+template<typename T, RendererConfiguration t_cfg, template <typename, ShaderConfiguration> class ShaderProgram>
+void Renderer<T, t_cfg, ShaderProgram>::processVertices(const ModelData* model)
+{
+    MICRORENDERER_TRACE_SCOPE_ARG("processVertices", "vertices", model->num_vertices);
+    uint16 vertex_idx = 0;
+    // Batches only pay off if the compiler can vectorize them, i.e. for floating-point scalars.
+    if constexpr (ShaderProgram_type::batched_vertex_shading && std::is_floating_point_v<T>) {
+        for (; vertex_idx + vertex_batch_size <= model->num_vertices; vertex_idx += vertex_batch_size) {
+            processVertexBatch(model->vertices + vertex_idx, vertex_buffers + vertex_idx);
+        }
+    }
+    // Remaining vertices one by one.
+    for (; vertex_idx < model->num_vertices; ++vertex_idx) {
+        processVertex({model->vertices + vertex_idx, vertex_buffers + vertex_idx});
+    }
+}
+
+template<typename T, RendererConfiguration t_cfg, template <typename, ShaderConfiguration> class ShaderProgram>
+void Renderer<T, t_cfg, ShaderProgram>::processVertexBatch(const VertexSource* sources, VertexBuffer* buffers)
+    requires(ShaderProgram_type::batched_vertex_shading && std::is_floating_point_v<T>)
+{
+    // Shade vertices.
+    Vector4Batch<T, vertex_batch_size> positions;
+    shader_program.shadeVertices({sources, buffers, &positions});
+    MICRORENDERER_COUNT(vertices_shaded, getGeometryCount(vertex_batch_size));
+
+    if constexpr (t_cfg.shader_cfg.projection == PERSPECTIVE) {
+        // Homogenize vertices like BaseVertexBuffer::homogenizeVertex(), but for all lanes at once, so that the
+        // reciprocals vectorize. Vertices before the near plane keep their w and screen position.
+        T inv_w[vertex_batch_size];
+        Vector3Batch<T, vertex_batch_size> screen_positions;
+        for (int32 lane = 0; lane < vertex_batch_size; ++lane) {
+            // Branch-free, reciprocals of lanes before the near plane are computed but not used.
+            inv_w[lane] = static_cast<T>(1.0) / positions.w[lane];
+            screen_positions.x[lane] = positions.x[lane] * inv_w[lane];
+            screen_positions.y[lane] = positions.y[lane] * inv_w[lane];
+            screen_positions.z[lane] = positions.z[lane] * inv_w[lane];
+        }
+        for (int32 lane = 0; lane < vertex_batch_size; ++lane) {
+            VertexBuffer& buffer = buffers[lane];
+            if (positions.w[lane] >= near_plane) {
+                buffer.clip_position = {positions.x[lane], positions.y[lane], positions.z[lane], inv_w[lane]};
+                buffer.screen_position = screen_positions.get(lane);
+            }
+            else {
+                buffer.clip_position = positions.get(lane);
+            }
+        }
+    }
+    else if constexpr (t_cfg.shader_cfg.projection == ORTHOGRAPHIC) {
+        for (int32 lane = 0; lane < vertex_batch_size; ++lane) {
+            buffers[lane].screen_position = {positions.x[lane], positions.y[lane], positions.z[lane]};
+        }
+    }
+}
+
+template<typename T, RendererConfiguration t_cfg, template <typename, ShaderConfiguration> class ShaderProgram>
+void Renderer<T, t_cfg, ShaderProgram>::processVertex(const VertexData& vertex)
+{
+    // Shade vertex.
+    shader_program.shadeVertex(vertex);
+    MICRORENDERER_COUNT(vertices_shaded, getGeometryCount(1));
+
+    // Homogenize vertex.
+    if constexpr(t_cfg.shader_cfg.projection == PERSPECTIVE) {
+        vertex.buffer->homogenizeVertex(near_plane);
+    }
+}
+
+template<typename T, RendererConfiguration t_cfg, template <typename, ShaderConfiguration> class ShaderProgram>
+uint32 Renderer<T, t_cfg, ShaderProgram>::getGeometryCount(uint32 amount) const
+{
+    if constexpr (t_cfg.deferred_setup == DEFERRED_SETUP_ENABLED) {
+        return scanline_render_data.activating_triangles ? 0 : amount;
+    }
+    else {
+        return amount;
+    }
+}
+
+template <typename T, RendererConfiguration t_cfg, template <typename, ShaderConfiguration> class ShaderProgram>
+void Renderer<T, t_cfg, ShaderProgram>::cullAndClipTriangles(const InstanceData& instance, const ModelData* model)
+{
+    if constexpr (requires { instance.model_screen_tf.transformPosition(Vector3<T>()); }) {
+        if (model->clusters != nullptr) {
+            const Vector4<T> view = computeModelViewVector(instance.model_screen_tf);
+            for (uint16 cluster_idx = 0; cluster_idx < model->num_clusters; ++cluster_idx) {
+                const ModelCluster<T>& cluster = model->clusters[cluster_idx];
+                if (isClusterCulled(instance.model_screen_tf, view, cluster)) {
+                    MICRORENDERER_COUNT(triangles_cluster_culled, cluster.num_triangles);
+                    continue;
+                }
+                const uint32 end_tri_idx = static_cast<uint32>(cluster.first_triangle) + cluster.num_triangles;
+                for (uint32 tri_idx = cluster.first_triangle; tri_idx < end_tri_idx; ++tri_idx) {
+                    cullAndClipTriangle(model, tri_idx);
+                }
+            }
+            return;
+        }
+    }
+    for (uint32 tri_idx = 0; tri_idx < static_cast<uint32>(model->num_triangles); ++tri_idx) {
+        cullAndClipTriangle(model, tri_idx);
+    }
+}
+
+template <typename T, RendererConfiguration t_cfg, template <typename, ShaderConfiguration> class ShaderProgram>
+void Renderer<T, t_cfg, ShaderProgram>::cullAndClipTriangle(const ModelData* model, uint32 tri_idx)
+{
+    // Gather vertex data.
+    const uint16 v1_idx = model->indices[tri_idx].vertex_1_idx;
+    const uint16 v2_idx = model->indices[tri_idx].vertex_2_idx;
+    const uint16 v3_idx = model->indices[tri_idx].vertex_3_idx;
+    const VertexData vertices[3] = {
+        {model->vertices + v1_idx, vertex_buffers + v1_idx},
+        {model->vertices + v2_idx, vertex_buffers + v2_idx},
+        {model->vertices + v3_idx, vertex_buffers + v3_idx}
+    };
+    cullAndClipTriangle(tri_idx, vertices);
+}
+
+template <typename T, RendererConfiguration t_cfg, template <typename, ShaderConfiguration> class ShaderProgram>
+void Renderer<T, t_cfg, ShaderProgram>::cullAndClipTriangle(uint32 tri_idx, const VertexData (&vertices)[3])
+{
+    const Vector3<T>& v1_screen_pos = vertices[0].buffer->screen_position;
+    const Vector3<T>& v2_screen_pos = vertices[1].buffer->screen_position;
+    const Vector3<T>& v3_screen_pos = vertices[2].buffer->screen_position;
+
+    // Backface culling and early degenerate check.
+    const Vector2<T> v1_to_v2 = {v2_screen_pos.x - v1_screen_pos.x, v2_screen_pos.y - v1_screen_pos.y};
+    const Vector2<T> v1_to_v3 = {v3_screen_pos.x - v1_screen_pos.x, v3_screen_pos.y - v1_screen_pos.y};
+    constexpr T DEGENERATE_THRESHOLD = static_cast<T>(0.001);
+    const T area = v1_to_v2.x * v1_to_v3.y - v1_to_v2.y * v1_to_v3.x;
+    if constexpr (t_cfg.front_face == COUNTERCLOCKWISE) {
+        if (area < DEGENERATE_THRESHOLD) { // Counter-clockwise vertex order yields positive area.
+            MICRORENDERER_COUNT(triangles_backface_culled, getGeometryCount(1));
+            return;
+        }
+    }
+    else {
+        if (area > -DEGENERATE_THRESHOLD) { // Clockwise vertex order yields negative area.
+            MICRORENDERER_COUNT(triangles_backface_culled, getGeometryCount(1));
+            return;
+        }
+    }
+
+    // Lambda for computing the outcode of a vertex for Cohen-Sutherland clipping.
+    auto getCohenSutherlandOutcode = [right_x_clip = this->right_x_clip, top_y_clip = this->top_y_clip]
+                                     (const Vector3<T>& position) -> uint8
+    {
+        constexpr T left_x_clip = static_cast<T>(-0.5);
+        constexpr T bottom_y_clip = static_cast<T>(-0.5);
+
+        constexpr uint8 OUTCODE_INSIDE = 0b0000;
         constexpr uint8 OUTCODE_LEFT   = 0b0001;
         constexpr uint8 OUTCODE_RIGHT  = 0b0010;
         constexpr uint8 OUTCODE_BOTTOM = 0b0100;
@@ -373,6 +1050,7 @@ void Renderer<T, t_cfg, ShaderProgram>::cullAndClipTriangle(const ModelData* mod
         // Skip triangles if certainly invisible according to the Cohen-Sutherland algorithm (no clipping).
         if ((getCohenSutherlandOutcode(v1_screen_pos) & getCohenSutherlandOutcode(v2_screen_pos) &
             getCohenSutherlandOutcode(v3_screen_pos)) != 0) {
+            MICRORENDERER_COUNT(triangles_outcode_culled, getGeometryCount(1));
             return;
         }
     }
@@ -402,16 +1080,18 @@ void Renderer<T, t_cfg, ShaderProgram>::cullAndClipTriangle(const ModelData* mod
 
                 if (num_visible_verts == 2) {
                     // Triangle is clipped into two new triangles.
+                    MICRORENDERER_COUNT(triangles_clipped_to_two, getGeometryCount(1));
                     const uint8 idx_1 = !v1_z_visible ? 0 : !v2_z_visible ? 1 : 2;
                     const uint8 idx_2 = idx_1 == 2 ? 0 : idx_1 + 1;
                     const uint8 idx_3 = idx_2 == 2 ? 0 : idx_2 + 1;
                     shader_program.interpolateVertices(vertices[idx_2], vertices[idx_1], clipped_sources, clipped_buffers);
                     shader_program.interpolateVertices(vertices[idx_3], vertices[idx_1], clipped_sources + 1, clipped_buffers + 1);
-                    processTriangle(tri_idx, vertices[idx_3], clipped_vertices[1], clipped_vertices[0]);
-                    processTriangle(tri_idx, vertices[idx_3], clipped_vertices[0], vertices[idx_2]);
+                    processTriangle(tri_idx, vertices[idx_3], clipped_vertices[1], clipped_vertices[0], 0);
+                    processTriangle(tri_idx, vertices[idx_3], clipped_vertices[0], vertices[idx_2], 1);
                 }
                 else {
                     // Triangle is clipped into one new triangle.
+                    MICRORENDERER_COUNT(triangles_clipped_to_one, getGeometryCount(1));
                     const uint8 idx_1 = v1_z_visible ? 0 : v2_z_visible ? 1 : 2;
                     const uint8 idx_2 = idx_1 == 2 ? 0 : idx_1 + 1;
                     const uint8 idx_3 = idx_2 == 2 ? 0 : idx_2 + 1;
@@ -486,7 +1166,7 @@ bool Renderer<T, t_cfg, ShaderProgram>::setupTriangleRasterization(uint32 tri_id
         // Compute half-triangle start and end y-coordinates.
         y_start = std::min(positions[left_idx]->y, positions[right_idx]->y) + TOPLEFT_EDGE_SHIFT; // Shift top edge slightly.
         const T y_end = positions[peak_idx]->y;
-        rasterization.y_halftri_end = static_cast<int16>(std::floor(y_end));
+        rasterization.y_halftri_end = static_cast<int16>(floor(y_end));
         rasterization.y_fulltri_end = rasterization.y_halftri_end;
     }
     else {
@@ -504,17 +1184,17 @@ bool Renderer<T, t_cfg, ShaderProgram>::setupTriangleRasterization(uint32 tri_id
         if (dy_middle_end < MIN_DELTA_Y) {
             // Second half-triangle is too lean in y. Only draw first half-triangle.
             const T y_end = std::min(positions[left_idx]->y, positions[right_idx]->y);
-            rasterization.y_halftri_end = static_cast<int16>(std::floor(y_end));
+            rasterization.y_halftri_end = static_cast<int16>(floor(y_end));
             rasterization.y_fulltri_end = rasterization.y_halftri_end;
         }
         else {
             // Draw potentially both half-triangles.
             const T y_end = positions[end_idx]->y;
             const T y_middle = positions[middle_idx]->y;
-            rasterization.y_halftri_end = static_cast<int16>(std::floor(y_middle));
+            rasterization.y_halftri_end = static_cast<int16>(floor(y_middle));
             if (rasterization.y_halftri_end < static_cast<int16>(height_minus_one)) {
                 // Draw both half-triangles.
-                rasterization.y_fulltri_end = static_cast<int16>(std::floor(y_end));
+                rasterization.y_fulltri_end = static_cast<int16>(floor(y_end));
 
                 // Compute second half-triangle changed edge slope and x-start coordinate.
                 rasterization.last_dx_per_dy = (positions[end_idx]->x - positions[middle_idx]->x) / (positions[end_idx]->y - positions[middle_idx]->y);
@@ -544,7 +1224,7 @@ bool Renderer<T, t_cfg, ShaderProgram>::setupTriangleRasterization(uint32 tri_id
     rasterization.right_dx_per_dy = dx_peak_right / dy_peak_right;
 
     // Compute start scanline.
-    T first_scanline = std::ceil(y_start);
+    T first_scanline = ceil(y_start);
     start_scanline = static_cast<int32>(first_scanline);
 
     // Adjust edge positions to start scanline.
@@ -618,9 +1298,16 @@ bool Renderer<T, t_cfg, ShaderProgram>::setupTriangleRasterization(uint32 tri_id
     }
 
     // Setup triangle and store initial interpolation position (prev_scanline_stop_x and start_scanline).
-    rasterization.prev_scanline_stop_x = static_cast<int16>(std::floor(rasterization.right_x));
+    rasterization.prev_scanline_stop_x = static_cast<int16>(floor(rasterization.right_x));
     shader_program.setupTriangle(tri_idx, v1, v2, v3, &rasterization.triangle_buffer,
                                  rasterization.prev_scanline_stop_x, start_scanline);
+    if constexpr (lazy_x_attributes) {
+        rasterization.attribute_x = rasterization.prev_scanline_stop_x;
+    }
+    if constexpr (flat_spans) {
+        rasterization.constant_in_x = shader_program.isConstantInX(&rasterization.triangle_buffer);
+    }
+    MICRORENDERER_COUNT(triangles_set_up, 1);
 
     return true;
 }
@@ -633,7 +1320,19 @@ typename BufferType::BufferPosition Renderer<T, t_cfg, ShaderProgram>::getPositi
         return buffer.getWrappedBufferPosition(x, y);
     }
     else if constexpr (t_cfg.render_mode == SCANLINE) {
-        return buffer.pixelNumToBufferPosition(x);
+        const int32 bucket_y = y - scanline_render_data.bucket_start_scanline;
+        return buffer.pixelNumToBufferPosition(x + buffer.getWidth() * bucket_y);
+    }
+    else if constexpr (t_cfg.render_mode == TILED) {
+        if constexpr (std::is_same_v<BufferType, Depthbuffer>) {
+            // Depthbuffer only covers the current tile.
+            const int32 tile_x = x - tiled_render_data.tile_x_min;
+            const int32 tile_y = y - tiled_render_data.tile_y_min;
+            return buffer.pixelNumToBufferPosition(tile_x + tile_size * tile_y);
+        }
+        else {
+            return buffer.getWrappedBufferPosition(x, y);
+        }
     }
     return {};
 }
@@ -643,54 +1342,103 @@ void Renderer<T, t_cfg, ShaderProgram>::shadeScanlineOfTriangle(RasterizationBuf
 {
     TriangleBuffer* triangle = &rasterization.triangle_buffer;
 
+    // Get horizontal pixel range to shade in.
+    int32 x_min = 0;
+    int32 x_max = width_minus_one;
+    if constexpr (t_cfg.render_mode == TILED) {
+        x_min = tiled_render_data.tile_x_min;
+        x_max = tiled_render_data.tile_x_max;
+    }
+
     // Compute start and end pixels of scanline.
-    const int32 x_start = std::max(static_cast<int32>(std::ceil(rasterization.left_x)), static_cast<int32>(0));
-    const int32 x_stop = std::min(static_cast<int32>(std::floor(rasterization.right_x)), width_minus_one);
+    const int32 span_x_start = static_cast<int32>(ceil(rasterization.left_x));
+    const int32 span_x_stop = static_cast<int32>(floor(rasterization.right_x));
+    const int32 x_start = std::max(span_x_start, x_min);
+    const int32 x_stop = std::min(span_x_stop, x_max);
     if (x_start <= x_stop) {
+        MICRORENDERER_COUNT(fragments_generated, x_stop - x_start + 1);
+        if constexpr (perspective_correction) {
+            // No part of the new scanline span is divided yet.
+            perspective_span.scanline_x_start = span_x_start;
+            perspective_span.scanline_x_stop = span_x_stop;
+            perspective_span.x_start = 1;
+            perspective_span.x_stop = 0;
+            perspective_span.x_end = -1;
+        }
+
         // Interpolate in x to first pixel on scanline.
         int32 initial_offset = x_start - static_cast<int32>(rasterization.prev_scanline_stop_x);
-        shader_program.template interpolateAttributes<IncrementationMode::OffsetInX>(triangle, initial_offset);
+        interpolateRasterization<IncrementationMode::OffsetInX>(triangle, initial_offset);
 
         // Store end of scanline for interpolation in x at next scanline.
         rasterization.prev_scanline_stop_x = x_stop;
 
         // Perform depth-test and shading of pixels on scanline, if enabled.
-        if constexpr(t_cfg.shader_cfg.shading == SHADING_DISABLED && t_cfg.shader_cfg.depth_test == DEPTH_TEST_ENABLED) {
+        if constexpr(t_cfg.hierarchical_depth == HIERARCHICAL_DEPTH_ENABLED) {
+            shadeSpanInDepthBlocks(rasterization, x_start, x_stop, scanline);
+            rasterization.prev_scanline_stop_x = static_cast<int16>(x_stop + 1);
+        }
+        else if constexpr(t_cfg.deferred_shading == DEFERRED_SHADING_ENABLED || simd_depth_test ||
+                          lazy_x_attributes || TriangleBuffer::flat_attributes ||
+                          (span_shading && t_cfg.shader_cfg.depth_test == DEPTH_TEST_ENABLED)) {
+            shadeDepthTestedSpan(rasterization, x_start, x_stop, scanline);
+            rasterization.prev_scanline_stop_x = static_cast<int16>(x_stop + 1);
+        }
+        else if constexpr(t_cfg.shader_cfg.shading == SHADING_DISABLED && t_cfg.shader_cfg.depth_test == DEPTH_TEST_ENABLED) {
             auto depthbuffer_position = getPositionInBuffer(depthbuffer, x_start, scanline);
             if (triangle->depth.getValue() > depthbuffer.readPixelAt(depthbuffer_position)) {
                 depthbuffer.drawPixelAt(depthbuffer_position, triangle->depth.getValue());
+                MICRORENDERER_COUNT(depth_tests_passed, 1);
             }
             for (int32 x = x_start; x < x_stop; ++x) {
                 shader_program.template interpolateAttributes<IncrementationMode::OneInX>(triangle);
                 depthbuffer.moveBufferPositionRight(depthbuffer_position);
                 if (triangle->depth.getValue() > depthbuffer.readPixelAt(depthbuffer_position)) {
                     depthbuffer.drawPixelAt(depthbuffer_position, triangle->depth.getValue());
+                    MICRORENDERER_COUNT(depth_tests_passed, 1);
                 }
             }
         }
+        else if constexpr(span_shading && t_cfg.shader_cfg.depth_test == DEPTH_TEST_DISABLED) {
+            auto framebuffer_position = getPositionInBuffer(framebuffer, x_start, scanline);
+            for (int32 x = x_start; x <= x_stop; x += color_span_size) {
+                const int32 length = std::min(color_span_size, x_stop + 1 - x);
+                shadeColorSpan(rasterization, x, framebuffer_position, length, 0xFFFFFFFF >> (color_span_size - length));
+            }
+            rasterization.prev_scanline_stop_x = static_cast<int16>(x_stop + 1);
+        }
         else if constexpr(t_cfg.shader_cfg.shading == SHADING_ENABLED && t_cfg.shader_cfg.depth_test == DEPTH_TEST_DISABLED) {
             auto framebuffer_position = getPositionInBuffer(framebuffer, x_start, scanline);
-            framebuffer.drawPixelAt(framebuffer_position, shader_program.computeColor(triangle));
+            framebuffer.drawPixelAt(framebuffer_position, computeColor(triangle));
             for (int32 x = x_start; x < x_stop; ++x) {
                 shader_program.template interpolateAttributes<IncrementationMode::OneInX>(triangle);
                 framebuffer.moveBufferPositionRight(framebuffer_position);
-                framebuffer.drawPixelAt(framebuffer_position, shader_program.computeColor(triangle));
+                framebuffer.drawPixelAt(framebuffer_position, computeColor(triangle));
             }
         }
         else if constexpr(t_cfg.shader_cfg.shading == SHADING_ENABLED && t_cfg.shader_cfg.depth_test == DEPTH_TEST_ENABLED) {
-            auto framebuffer_position = getPositionInBuffer(framebuffer, x_start, scanline);
-            auto depthbuffer_position = getPositionInBuffer(depthbuffer, x_start, scanline);
-            if (triangle->depth.getValue() > depthbuffer.readPixelAt(depthbuffer_position)) {
-                depthbuffer.drawPixelAt(depthbuffer_position, triangle->depth.getValue());
-                framebuffer.drawPixelAt(framebuffer_position, shader_program.computeColor(triangle));
+            if (isFlat(rasterization)) {
+                // Attributes are constant along the scanline, so the span is filled with a single color.
+                shadeDepthTestedSpan(rasterization, x_start, x_stop, scanline);
+                rasterization.prev_scanline_stop_x = static_cast<int16>(x_stop + 1);
             }
-            for (int32 x = x_start; x < x_stop; ++x) {
-                shader_program.template interpolateAttributes<IncrementationMode::OneInX>(triangle);
-                framebuffer.moveBufferPositionRight(framebuffer_position);
-                depthbuffer.moveBufferPositionRight(depthbuffer_position);
+            else {
+                auto framebuffer_position = getPositionInBuffer(framebuffer, x_start, scanline);
+                auto depthbuffer_position = getPositionInBuffer(depthbuffer, x_start, scanline);
                 if (triangle->depth.getValue() > depthbuffer.readPixelAt(depthbuffer_position)) {
                     depthbuffer.drawPixelAt(depthbuffer_position, triangle->depth.getValue());
-                    framebuffer.drawPixelAt(framebuffer_position, shader_program.computeColor(triangle));
+                    MICRORENDERER_COUNT(depth_tests_passed, 1);
+                    framebuffer.drawPixelAt(framebuffer_position, computeColor(triangle));
+                }
+                for (int32 x = x_start; x < x_stop; ++x) {
+                    shader_program.template interpolateAttributes<IncrementationMode::OneInX>(triangle);
+                    framebuffer.moveBufferPositionRight(framebuffer_position);
+                    depthbuffer.moveBufferPositionRight(depthbuffer_position);
+                    if (triangle->depth.getValue() > depthbuffer.readPixelAt(depthbuffer_position)) {
+                        depthbuffer.drawPixelAt(depthbuffer_position, triangle->depth.getValue());
+                        MICRORENDERER_COUNT(depth_tests_passed, 1);
+                        framebuffer.drawPixelAt(framebuffer_position, computeColor(triangle));
+                    }
                 }
             }
         }
@@ -701,7 +1449,395 @@ void Renderer<T, t_cfg, ShaderProgram>::shadeScanlineOfTriangle(RasterizationBuf
     rasterization.right_x += rasterization.right_dx_per_dy;
 
     // Interpolate in y to next scanline.
-    shader_program.template interpolateAttributes<IncrementationMode::OneInY>(triangle);
+    interpolateRasterization<IncrementationMode::OneInY>(triangle);
+}
+
+template<typename T, RendererConfiguration t_cfg, template <typename, ShaderConfiguration> class ShaderProgram>
+template<IncrementationMode mode>
+void Renderer<T, t_cfg, ShaderProgram>::interpolateRasterization(TriangleBuffer* triangle, int32 offset)
+{
+    constexpr bool in_x = mode == IncrementationMode::OneInX || mode == IncrementationMode::OffsetInX;
+    if constexpr (t_cfg.deferred_shading == DEFERRED_SHADING_ENABLED ||
+                  (lazy_x_attributes && in_x)) {
+        shader_program.template interpolateDepth<mode>(triangle, offset);
+    }
+    else {
+        shader_program.template interpolateAttributes<mode>(triangle, offset);
+    }
+}
+
+template<typename T, RendererConfiguration t_cfg, template <typename, ShaderConfiguration> class ShaderProgram>
+bool Renderer<T, t_cfg, ShaderProgram>::shadeDepthTestedSpan(RasterizationBuffer& rasterization, int32 x_start, int32 x_stop,
+                                                              int32 scanline) requires(t_cfg.shader_cfg.depth_test == DEPTH_TEST_ENABLED)
+{
+    if constexpr (flat_spans) {
+        if (rasterization.constant_in_x) {
+            return shadeFlatSpan(rasterization, x_start, x_stop, scanline);
+        }
+    }
+    TriangleBuffer* triangle = &rasterization.triangle_buffer;
+    [[maybe_unused]] TriangleBuffer fragment;
+    // Deferred shading stores the visible triangle instead of computing colors.
+    constexpr bool compute_colors = t_cfg.shader_cfg.shading == SHADING_ENABLED && t_cfg.deferred_shading == DEFERRED_SHADING_DISABLED;
+    T* depth_row = getPositionInBuffer(depthbuffer, x_start, scanline).address;
+    auto framebuffer_position = [&] {
+        if constexpr (compute_colors) {
+            return getPositionInBuffer(framebuffer, x_start, scanline);
+        }
+        else {
+            return std::monostate();
+        }
+    }();
+
+    // Lambda for interpolating attributes and moving in framebuffer by pixels to the right.
+    auto moveRight = [&](int32 num_pixels) {
+        if (num_pixels == 1) {
+            interpolateRasterization<IncrementationMode::OneInX>(triangle);
+        }
+        else {
+            interpolateRasterization<IncrementationMode::OffsetInX>(triangle, num_pixels);
+        }
+        if constexpr (compute_colors) {
+            for (int32 i = 0; i < num_pixels; ++i) {
+                framebuffer.moveBufferPositionRight(framebuffer_position);
+            }
+        }
+    };
+
+    // Lambda for storing the triangle as visible at a pixel.
+    [[maybe_unused]] auto storeVisibility = [&](int32 x) {
+        if constexpr (t_cfg.deferred_shading == DEFERRED_SHADING_ENABLED) {
+            const int32 tile_x = x - tiled_render_data.tile_x_min;
+            const int32 tile_y = scanline - tiled_render_data.tile_y_min;
+            tiled_render_data.visibility[tile_x + tile_size * tile_y] = tiled_render_data.current_buffer_idx;
+        }
+    };
+
+    bool any_passed = false;
+    int32 x = x_start;
+    if constexpr (compute_colors && span_shading) {
+        // Depth-test a span of pixels with a copy of the depth, then compute the colors of passing pixels at once.
+        for (int32 length; x <= x_stop; x += length) {
+            length = std::min(color_span_size, x_stop + 1 - x);
+            if constexpr (perspective_correction) {
+                // Spans interpolate linearly, so they end at the part of the scanline span x is in.
+                constexpr int32 part_size = t_cfg.shader_cfg.perspective_span_size;
+                length = std::min(length, part_size - (x & (part_size - 1)));
+            }
+            T* span_depth_row = depth_row + (x - x_start);
+            auto depth = triangle->depth;
+            uint32 pass_mask = 0;
+            int32 i = 0;
+#ifdef MICRORENDERER_SIMD
+            constexpr int32 lanes = depth_test_lanes<T>;
+            if constexpr (lanes > 1) {
+                for (; i + lanes <= length; i += lanes) {
+                    pass_mask |= depthTestLanes(span_depth_row + i, depth.getValue(), depth.getIncrementX()) << i;
+                    depth.template increment<IncrementationMode::OffsetInX>(lanes);
+                }
+            }
+#endif
+            for (; i < length; ++i) {
+                if (depth.getValue() > span_depth_row[i]) {
+                    span_depth_row[i] = depth.getValue();
+                    pass_mask |= 1u << i;
+                }
+                depth.template increment<IncrementationMode::OneInX>();
+            }
+            any_passed |= pass_mask != 0;
+            MICRORENDERER_COUNT(depth_tests_passed, std::popcount(pass_mask));
+            shadeColorSpan(rasterization, x, framebuffer_position, length, pass_mask);
+        }
+        return any_passed;
+    }
+#ifdef MICRORENDERER_SIMD
+    constexpr int32 lanes = depth_test_lanes<T>;
+    if constexpr (lanes > 1) {
+        // Depth-test blocks of pixels at once, then shade passing pixels only. Attributes are at pixel x.
+        const T depth_increment = triangle->depth.getIncrementX();
+        for (; x + lanes - 1 <= x_stop; x += lanes) {
+            uint32 pass_mask = depthTestLanes(depth_row + (x - x_start), triangle->depth.getValue(), depth_increment);
+            any_passed |= pass_mask != 0;
+            MICRORENDERER_COUNT(depth_tests_passed, std::popcount(pass_mask));
+            int32 lane = 0;
+            if constexpr (compute_colors) {
+                while (pass_mask) {
+                    const int32 next_lane = std::countr_zero(pass_mask);
+                    pass_mask &= pass_mask - 1;
+                    if (next_lane != lane) {
+                        moveRight(next_lane - lane);
+                        lane = next_lane;
+                    }
+                    framebuffer.drawPixelAt(framebuffer_position, computeColor(getAttributesAt(rasterization, x + lane, fragment)));
+                }
+            }
+            else if constexpr (t_cfg.deferred_shading == DEFERRED_SHADING_ENABLED) {
+                for (; pass_mask; pass_mask &= pass_mask - 1) {
+                    storeVisibility(x + std::countr_zero(pass_mask));
+                }
+            }
+            moveRight(lanes - lane);
+        }
+    }
+#endif
+
+    // Remaining pixels one at a time.
+    for (; x <= x_stop; ++x) {
+        T* depth = depth_row + (x - x_start);
+        if (triangle->depth.getValue() > *depth) {
+            *depth = triangle->depth.getValue();
+            any_passed = true;
+            MICRORENDERER_COUNT(depth_tests_passed, 1);
+            if constexpr (compute_colors) {
+                framebuffer.drawPixelAt(framebuffer_position, computeColor(getAttributesAt(rasterization, x, fragment)));
+            }
+            else if constexpr (t_cfg.deferred_shading == DEFERRED_SHADING_ENABLED) {
+                storeVisibility(x);
+            }
+        }
+        moveRight(1);
+    }
+
+    return any_passed;
+}
+
+template<typename T, RendererConfiguration t_cfg, template <typename, ShaderConfiguration> class ShaderProgram>
+bool Renderer<T, t_cfg, ShaderProgram>::isFlat(const RasterizationBuffer& rasterization)
+{
+    if constexpr (flat_spans) {
+        return rasterization.constant_in_x;
+    }
+    else {
+        return false;
+    }
+}
+
+template<typename T, RendererConfiguration t_cfg, template <typename, ShaderConfiguration> class ShaderProgram>
+bool Renderer<T, t_cfg, ShaderProgram>::shadeFlatSpan(RasterizationBuffer& rasterization, int32 x_start, int32 x_stop,
+                                                       int32 scanline) requires(flat_spans)
+{
+    TriangleBuffer* triangle = &rasterization.triangle_buffer;
+    T* depth_row = getPositionInBuffer(depthbuffer, x_start, scanline).address;
+    auto framebuffer_position = getPositionInBuffer(framebuffer, x_start, scanline);
+    // Color of the span, computed at the first pixel passing the depth test.
+    ShaderOutput color;
+    auto computeSpanColor = [&] {
+        TriangleBuffer fragment;
+        color = computeColor(getAttributesAt(rasterization, x_start, fragment));
+    };
+    auto depth = triangle->depth;
+    bool any_passed = false;
+    int32 x = x_start;
+#ifdef MICRORENDERER_SIMD
+    constexpr int32 lanes = depth_test_lanes<T>;
+    if constexpr (lanes > 1) {
+        for (; x + lanes - 1 <= x_stop; x += lanes) {
+            const uint32 pass_mask = depthTestLanes(depth_row + (x - x_start), depth.getValue(), depth.getIncrementX());
+            depth.template increment<IncrementationMode::OffsetInX>(lanes);
+            if (pass_mask != 0 && !any_passed) {
+                computeSpanColor();
+            }
+            any_passed |= pass_mask != 0;
+            MICRORENDERER_COUNT(depth_tests_passed, std::popcount(pass_mask));
+            for (int32 lane = 0; lane < lanes; ++lane) {
+                if (pass_mask & (1u << lane)) {
+                    framebuffer.drawPixelAt(framebuffer_position, color);
+                }
+                framebuffer.moveBufferPositionRight(framebuffer_position);
+            }
+        }
+    }
+#endif
+    for (; x <= x_stop; ++x) {
+        T* pixel_depth = depth_row + (x - x_start);
+        if (depth.getValue() > *pixel_depth) {
+            *pixel_depth = depth.getValue();
+            if (!any_passed) {
+                computeSpanColor();
+            }
+            any_passed = true;
+            MICRORENDERER_COUNT(depth_tests_passed, 1);
+            framebuffer.drawPixelAt(framebuffer_position, color);
+        }
+        depth.template increment<IncrementationMode::OneInX>();
+        framebuffer.moveBufferPositionRight(framebuffer_position);
+    }
+    interpolateRasterization<IncrementationMode::OffsetInX>(triangle, x_stop + 1 - x_start);
+    return any_passed;
+}
+
+template<typename T, RendererConfiguration t_cfg, template <typename, ShaderConfiguration> class ShaderProgram>
+void Renderer<T, t_cfg, ShaderProgram>::shadeSpanInDepthBlocks(RasterizationBuffer& rasterization, int32 x_start, int32 x_stop,
+                                                                int32 scanline) requires(t_cfg.hierarchical_depth == HIERARCHICAL_DEPTH_ENABLED)
+{
+    TriangleBuffer* triangle = &rasterization.triangle_buffer;
+    const T depth_increment = triangle->depth.getIncrementX();
+    for (int32 x = x_start; x <= x_stop;) {
+        // Part of the span inside the current block. Tiles are aligned to blocks.
+        const int32 segment_stop = std::min(x | (depth_block_size - 1), x_stop);
+        DepthBlock& block = getDepthBlock(x, scanline);
+
+        // Depth is linear along the span, so the segment is nearest at one of its ends.
+        const T segment_start_depth = triangle->depth.getValue();
+        const T segment_stop_depth = segment_start_depth + depth_increment * static_cast<T>(segment_stop - x);
+        if (std::max(segment_start_depth, segment_stop_depth) <= block.min_depth) {
+            // Segment is behind every pixel of the block.
+            interpolateRasterization<IncrementationMode::OffsetInX>(triangle, segment_stop + 1 - x);
+        }
+        else if (shadeDepthTestedSpan(rasterization, x, segment_stop, scanline)) {
+            block.dirty = true;
+        }
+        x = segment_stop + 1;
+    }
+}
+
+template<typename T, RendererConfiguration t_cfg, template <typename, ShaderConfiguration> class ShaderProgram>
+typename Renderer<T, t_cfg, ShaderProgram>::DepthBlock& Renderer<T, t_cfg, ShaderProgram>::getDepthBlock(int32 x, int32 y)
+    requires(t_cfg.hierarchical_depth == HIERARCHICAL_DEPTH_ENABLED)
+{
+    if constexpr (t_cfg.render_mode == TILED) {
+        // Depth blocks only cover the current tile.
+        x -= tiled_render_data.tile_x_min;
+        y -= tiled_render_data.tile_y_min;
+    }
+    return hierarchical_depth_data.blocks[(y / depth_block_size) * hierarchical_depth_data.num_blocks_x + x / depth_block_size];
+}
+
+template<typename T, RendererConfiguration t_cfg, template <typename, ShaderConfiguration> class ShaderProgram>
+void Renderer<T, t_cfg, ShaderProgram>::refreshDepthBlocks() requires(t_cfg.hierarchical_depth == HIERARCHICAL_DEPTH_ENABLED)
+{
+    // Get pixel range covered by the depthbuffer.
+    int32 x_min = 0;
+    int32 x_max = width_minus_one;
+    int32 y_min = 0;
+    int32 y_max = height_minus_one;
+    if constexpr (t_cfg.render_mode == TILED) {
+        x_min = tiled_render_data.tile_x_min;
+        x_max = tiled_render_data.tile_x_max;
+        y_min = tiled_render_data.tile_y_min;
+        y_max = tiled_render_data.tile_y_max;
+    }
+
+    for (int32 block_y = y_min; block_y <= y_max; block_y += depth_block_size) {
+        for (int32 block_x = x_min; block_x <= x_max; block_x += depth_block_size) {
+            DepthBlock& block = getDepthBlock(block_x, block_y);
+            if (!block.dirty) {
+                continue;
+            }
+            const int32 block_x_max = std::min(block_x + depth_block_size - 1, x_max);
+            const int32 block_y_max = std::min(block_y + depth_block_size - 1, y_max);
+            T min_depth = getPositionInBuffer(depthbuffer, block_x, block_y).address[0];
+            for (int32 y = block_y; y <= block_y_max; ++y) {
+                const T* depth_row = getPositionInBuffer(depthbuffer, block_x, y).address;
+                for (int32 x = 0; x <= block_x_max - block_x; ++x) {
+                    min_depth = std::min(min_depth, depth_row[x]);
+                }
+            }
+            block.min_depth = min_depth;
+            block.dirty = false;
+        }
+    }
+}
+
+template<typename T, RendererConfiguration t_cfg, template <typename, ShaderConfiguration> class ShaderProgram>
+typename Renderer<T, t_cfg, ShaderProgram>::ShaderOutput Renderer<T, t_cfg, ShaderProgram>::computeColor(TriangleBuffer* triangle)
+    requires(t_cfg.shader_cfg.shading == SHADING_ENABLED)
+{
+    MICRORENDERER_COUNT(colors_computed, 1);
+    return shader_program.computeColor(triangle);
+}
+
+template<typename T, RendererConfiguration t_cfg, template <typename, ShaderConfiguration> class ShaderProgram>
+typename Renderer<T, t_cfg, ShaderProgram>::TriangleBuffer* Renderer<T, t_cfg, ShaderProgram>::getAttributesAt(
+    RasterizationBuffer& rasterization, int32 x, TriangleBuffer& fragment)
+{
+    if constexpr (perspective_correction) {
+        // Interpolated linearly from the start of the part x is in, depth is already at x.
+        if (x < perspective_span.x_start || x > perspective_span.x_stop) {
+            updatePerspectiveSpan(rasterization, x);
+        }
+        fragment.attributes.template evaluateInX<span_shading>(perspective_span.start.attributes,
+                                                               x - perspective_span.x_start);
+        return &fragment;
+    }
+    else if constexpr (t_cfg.lazy_attributes == LAZY_ATTRIBUTES_ENABLED) {
+        // Evaluated in one step from the attributes' column.
+        const int32 offset = x - static_cast<int32>(rasterization.attribute_x);
+        if constexpr (requires { fragment.attributes.template evaluateInX<span_shading>(fragment.attributes, offset); }) {
+            fragment.attributes.template evaluateInX<span_shading>(rasterization.triangle_buffer.attributes, offset);
+        }
+        else {
+            // Attributes of the shader's own layout can only be interpolated in a copy of the whole buffer.
+            fragment = rasterization.triangle_buffer;
+            shader_program.template interpolateShaderAttributes<IncrementationMode::OffsetInX>(&fragment, offset);
+        }
+        return &fragment;
+    }
+    else {
+        return &rasterization.triangle_buffer;
+    }
+}
+
+template<typename T, RendererConfiguration t_cfg, template <typename, ShaderConfiguration> class ShaderProgram>
+void Renderer<T, t_cfg, ShaderProgram>::updatePerspectiveSpan(RasterizationBuffer& rasterization, int32 x)
+    requires(perspective_correction)
+{
+    // Parts are aligned to multiples of perspective_span_size, and clamped to the triangle's span on the scanline only,
+    // so that attributes are divided at the same pixels whether the span is clipped to a tile or not.
+    constexpr int32 part_size = t_cfg.shader_cfg.perspective_span_size;
+    PerspectiveSpanData& span = perspective_span;
+    const int32 part_start = x & ~(part_size - 1);
+    const int32 x_start = std::max(part_start, span.scanline_x_start);
+    const int32 x_end = std::min(part_start + part_size, span.scanline_x_stop);
+    if (span.x_end == x_start) {
+        // Parts are mostly visited left to right, so the end of the last part is the start of this one.
+        span.start = span.end;
+    }
+    else {
+        computePerspectiveAttributes(rasterization, x_start, span.start);
+    }
+    computePerspectiveAttributes(rasterization, x_end, span.end);
+    const T inv_num_pixels = x_end > x_start ? static_cast<T>(1.0) / static_cast<T>(x_end - x_start) : static_cast<T>(0.0);
+    span.start.attributes.setLinearIncrementsX(span.end.attributes, inv_num_pixels);
+    span.x_start = x_start;
+    span.x_stop = std::min(part_start + part_size - 1, span.scanline_x_stop);
+    span.x_end = x_end;
+}
+
+template<typename T, RendererConfiguration t_cfg, template <typename, ShaderConfiguration> class ShaderProgram>
+void Renderer<T, t_cfg, ShaderProgram>::computePerspectiveAttributes(const RasterizationBuffer& rasterization, int32 x,
+                                                                      TriangleBuffer& fragment) requires(perspective_correction)
+{
+    const int32 offset = x - static_cast<int32>(rasterization.attribute_x);
+    auto inv_w = rasterization.triangle_buffer.inv_w;
+    inv_w.template increment<IncrementationMode::OffsetInX>(offset);
+    fragment.attributes.template evaluateInX<false>(rasterization.triangle_buffer.attributes, offset);
+    fragment.attributes.scaleValues(static_cast<T>(1.0) / inv_w.getValue());
+}
+
+template<typename T, RendererConfiguration t_cfg, template <typename, ShaderConfiguration> class ShaderProgram>
+template<typename BufferPosition>
+void Renderer<T, t_cfg, ShaderProgram>::shadeColorSpan(RasterizationBuffer& rasterization, int32 x,
+                                                        BufferPosition& framebuffer_position, int32 length, uint32 mask)
+    requires(span_shading)
+{
+    ShaderOutput colors[color_span_size];
+    if (mask != 0) {
+        MICRORENDERER_COUNT(colors_computed, std::popcount(mask));
+        TriangleBuffer fragment;
+        shader_program.computeColorSpan(getAttributesAt(rasterization, x, fragment), {length, mask, colors});
+    }
+    int32 i = 0;
+    for (; mask != 0; mask &= mask - 1) {
+        for (const int32 next_i = std::countr_zero(mask); i < next_i; ++i) {
+            framebuffer.moveBufferPositionRight(framebuffer_position);
+        }
+        framebuffer.drawPixelAt(framebuffer_position, colors[i]);
+    }
+    for (; i < length; ++i) {
+        framebuffer.moveBufferPositionRight(framebuffer_position);
+    }
+    interpolateRasterization<IncrementationMode::OffsetInX>(&rasterization.triangle_buffer, length);
 }
 
 template<typename T, RendererConfiguration t_cfg, template <typename, ShaderConfiguration> class ShaderProgram>
@@ -711,9 +1847,15 @@ void Renderer<T, t_cfg, ShaderProgram>::shadeFullTriangle(RasterizationBuffer& r
     // First half: scanlines contained between the two edges closest to y=0.
     // Second half: scanlines contained between the two edges farmost of y=0.
 
+    // Get last scanline to shade.
+    int32 y_max = height_minus_one;
+    if constexpr (t_cfg.render_mode == TILED) {
+        y_max = tiled_render_data.tile_y_max;
+    }
+
     // Lambda for rasterizing half a triangle.
-    auto rasterizeHalfTriangle = [&rasterization, this](int32 y_start) {
-        const int32 y_end = std::min(static_cast<int32>(rasterization.y_halftri_end), height_minus_one);
+    auto rasterizeHalfTriangle = [&rasterization, y_max, this](int32 y_start) {
+        const int32 y_end = std::min(static_cast<int32>(rasterization.y_halftri_end), y_max);
         for (int32 y = y_start; y <= y_end; ++y) {
             shadeScanlineOfTriangle(rasterization, y);
         }
@@ -746,8 +1888,159 @@ void Renderer<T, t_cfg, ShaderProgram>::shadeFullTriangle(RasterizationBuffer& r
     rasterizeHalfTriangle(start_scanline);
 }
 
+template<typename T, RendererConfiguration t_cfg, template <typename, ShaderConfiguration> class ShaderProgram>
+void Renderer<T, t_cfg, ShaderProgram>::advanceTriangleRasterization(RasterizationBuffer& rasterization,
+                                                                     int32 from_scanline, int32 to_scanline)
+{
+    const int32 num_scanlines = to_scanline - from_scanline;
+    if (num_scanlines <= 0) {
+        return;
+    }
+
+    if (to_scanline > static_cast<int32>(rasterization.y_halftri_end)) {
+        // Skip first half-triangle. The middle edge starts at the scanline after the first half-triangle has ended.
+        const int32 num_second_half_scanlines = to_scanline - static_cast<int32>(rasterization.y_halftri_end) - 1;
+        if (rasterization.last_is_left) {
+            // Left is middle.
+            rasterization.left_x = rasterization.last_x + rasterization.last_dx_per_dy * static_cast<T>(num_second_half_scanlines);
+            rasterization.left_dx_per_dy = rasterization.last_dx_per_dy;
+            rasterization.right_x += rasterization.right_dx_per_dy * static_cast<T>(num_scanlines);
+        }
+        else {
+            // Right is middle.
+            rasterization.right_x = rasterization.last_x + rasterization.last_dx_per_dy * static_cast<T>(num_second_half_scanlines);
+            rasterization.right_dx_per_dy = rasterization.last_dx_per_dy;
+            rasterization.left_x += rasterization.left_dx_per_dy * static_cast<T>(num_scanlines);
+        }
+        rasterization.y_halftri_end = rasterization.y_fulltri_end;
+    }
+    else {
+        // Advance edges inside first half-triangle.
+        rasterization.left_x += rasterization.left_dx_per_dy * static_cast<T>(num_scanlines);
+        rasterization.right_x += rasterization.right_dx_per_dy * static_cast<T>(num_scanlines);
+    }
+
+    // Interpolate in y to new scanline.
+    interpolateRasterization<IncrementationMode::OffsetInY>(&rasterization.triangle_buffer, num_scanlines);
+}
+
+template<typename T, RendererConfiguration t_cfg, template <typename, ShaderConfiguration> class ShaderProgram>
+void Renderer<T, t_cfg, ShaderProgram>::shadeTile(uint32 tile_idx) requires(t_cfg.render_mode == TILED)
+{
+    MICRORENDERER_TRACE_SCOPE_ARG("shadeTile", "tile", tile_idx);
+    TiledRenderData& data = tiled_render_data;
+    const TileBin& bin = data.bins[tile_idx];
+    if (bin.first_entry == TILE_BIN_END) {
+        // No triangle overlaps tile.
+        return;
+    }
+
+    // Compute pixel bounds of tile.
+    data.tile_x_min = (static_cast<int32>(tile_idx) % data.num_tiles_x) * tile_size;
+    data.tile_y_min = (static_cast<int32>(tile_idx) / data.num_tiles_x) * tile_size;
+    data.tile_x_max = std::min(data.tile_x_min + tile_size - 1, width_minus_one);
+    data.tile_y_max = std::min(data.tile_y_min + tile_size - 1, height_minus_one);
+
+    // Depthbuffer of tile lives on the stack and is cleared to the far plane (reversed-z).
+    std::conditional_t<t_cfg.shader_cfg.depth_test == DEPTH_TEST_ENABLED, T[tile_size * tile_size], std::monostate> tile_depth;
+    if constexpr (t_cfg.shader_cfg.depth_test == DEPTH_TEST_ENABLED) {
+        depthbuffer.setBuffer(tile_depth);
+        depthbuffer.clearBuffer(static_cast<T>(0.0));
+    }
+
+    // Depth blocks of tile match the cleared depthbuffer.
+    constexpr int32 num_tile_blocks = (tile_size / depth_block_size) * (tile_size / depth_block_size);
+    std::conditional_t<t_cfg.hierarchical_depth == HIERARCHICAL_DEPTH_ENABLED, DepthBlock[num_tile_blocks], std::monostate> tile_depth_blocks;
+    if constexpr (t_cfg.hierarchical_depth == HIERARCHICAL_DEPTH_ENABLED) {
+        std::fill_n(tile_depth_blocks, num_tile_blocks, DepthBlock{static_cast<T>(0.0), false});
+        hierarchical_depth_data.blocks = tile_depth_blocks;
+    }
+
+    // Visibility of tile is empty until triangles are rasterized.
+    std::conditional_t<t_cfg.deferred_shading == DEFERRED_SHADING_ENABLED, uint16[tile_size * tile_size], std::monostate> tile_visibility;
+    if constexpr (t_cfg.deferred_shading == DEFERRED_SHADING_ENABLED) {
+        std::fill_n(tile_visibility, tile_size * tile_size, VISIBILITY_NONE);
+        data.visibility = tile_visibility;
+    }
+
+    // Shade triangles overlapping tile in the order they were processed.
+    [[maybe_unused]] uint16 shaded_instance_idx = data.buffers[data.entries[bin.first_entry].buffer_idx].instance_idx;
+    for (uint32 entry_idx = bin.first_entry; entry_idx != TILE_BIN_END; entry_idx = data.entries[entry_idx].next_entry) {
+        // Work on a copy, since the stored rasterization buffer is shared by all tiles the triangle overlaps.
+        data.current_buffer_idx = data.entries[entry_idx].buffer_idx;
+        RasterizationBuffer rasterization = data.buffers[data.current_buffer_idx];
+
+        if constexpr (t_cfg.hierarchical_depth == HIERARCHICAL_DEPTH_ENABLED) {
+            // Let triangles of following instances be rejected against the previous ones.
+            if (rasterization.instance_idx != shaded_instance_idx) {
+                refreshDepthBlocks();
+                shaded_instance_idx = rasterization.instance_idx;
+            }
+        }
+
+        // Set instance data.
+        shader_program.setInstanceData(instances + rasterization.instance_idx);
+
+        // Advance rasterization to first scanline inside tile and shade.
+        const int32 start_scanline = std::max(static_cast<int32>(rasterization.start_scanline), data.tile_y_min);
+        advanceTriangleRasterization(rasterization, rasterization.start_scanline, start_scanline);
+        shadeFullTriangle(rasterization, start_scanline);
+    }
+
+    if constexpr (t_cfg.deferred_shading == DEFERRED_SHADING_ENABLED) {
+        // Shade each covered pixel once.
+        shadeVisibleTriangles();
+    }
+}
+
+template<typename T, RendererConfiguration t_cfg, template <typename, ShaderConfiguration> class ShaderProgram>
+void Renderer<T, t_cfg, ShaderProgram>::shadeVisibleTriangles() requires(t_cfg.deferred_shading == DEFERRED_SHADING_ENABLED)
+{
+    TiledRenderData& data = tiled_render_data;
+    uint16 instance_idx = 0xFFFF;
+    for (int32 y = data.tile_y_min; y <= data.tile_y_max; ++y) {
+        const uint16* visibility_row = data.visibility + tile_size * (y - data.tile_y_min) - data.tile_x_min;
+        int32 x = data.tile_x_min;
+        while (x <= data.tile_x_max) {
+            const uint16 buffer_idx = visibility_row[x];
+            if (buffer_idx == VISIBILITY_NONE) {
+                ++x;
+                continue;
+            }
+
+            // Find run of pixels showing the same triangle.
+            int32 run_stop = x;
+            while (run_stop < data.tile_x_max && visibility_row[run_stop + 1] == buffer_idx) {
+                ++run_stop;
+            }
+
+            // Set instance data.
+            const RasterizationBuffer& rasterization = data.buffers[buffer_idx];
+            if (rasterization.instance_idx != instance_idx) {
+                instance_idx = rasterization.instance_idx;
+                shader_program.setInstanceData(instances + instance_idx);
+            }
+
+            // Interpolate attributes from the triangle's initial position to the start of the run, then along the run.
+            TriangleBuffer triangle = rasterization.triangle_buffer;
+            shader_program.template interpolateAttributes<IncrementationMode::OffsetInY>(
+                &triangle, y - static_cast<int32>(rasterization.start_scanline));
+            shader_program.template interpolateAttributes<IncrementationMode::OffsetInX>(
+                &triangle, x - static_cast<int32>(rasterization.prev_scanline_stop_x));
+            auto framebuffer_position = getPositionInBuffer(framebuffer, x, y);
+            framebuffer.drawPixelAt(framebuffer_position, computeColor(&triangle));
+            for (++x; x <= run_stop; ++x) {
+                shader_program.template interpolateAttributes<IncrementationMode::OneInX>(&triangle);
+                framebuffer.moveBufferPositionRight(framebuffer_position);
+                framebuffer.drawPixelAt(framebuffer_position, computeColor(&triangle));
+            }
+        }
+    }
+}
+
 template <typename T, RendererConfiguration t_cfg, template <typename, ShaderConfiguration> class ShaderProgram>
-void Renderer<T, t_cfg, ShaderProgram>::processTriangle(uint32 tri_idx, VertexData v1, VertexData v2, VertexData v3)
+void Renderer<T, t_cfg, ShaderProgram>::processTriangle(uint32 tri_idx, VertexData v1, VertexData v2, VertexData v3,
+                                                         [[maybe_unused]] uint8 clip_half)
 {
     if constexpr (t_cfg.render_mode == FRAMEBUFFER) {
         // Setup triangle and rasterization.
@@ -758,19 +2051,80 @@ void Renderer<T, t_cfg, ShaderProgram>::processTriangle(uint32 tri_idx, VertexDa
             shadeFullTriangle(rasterization, start_scanline);
         }
     }
+    else if constexpr (t_cfg.deferred_setup == DEFERRED_SETUP_ENABLED) {
+        ScanlineRenderData& data = scanline_render_data;
+        if (data.activating_triangles) {
+            if (clip_half != data.activating_clip_half) {
+                return;
+            }
+
+            // Get next free rasterization buffer if any, the triangle is lost otherwise.
+            if (data.num_active_buffers >= data.max_num_buffers) {
+                ++data.num_overflows;
+                return;
+            }
+            RasterizationBuffer& rasterization = data.buffers[data.buffer_slots[data.num_active_buffers]];
+
+            // Setup triangle and rasterization and mark buffer active.
+            int32 start_scanline;
+            if (setupTriangleRasterization(tri_idx, v1, v2, v3, rasterization, start_scanline) &&
+                advanceToSlab(rasterization, start_scanline)) {
+                rasterization.instance_idx = data.instance_idx_marker;
+                rasterization.start_scanline = static_cast<int16>(start_scanline);
+                ++data.num_active_buffers;
+            }
+            return;
+        }
+
+        // Skip triangles outside of the current slab, clipped triangles starting above start at the slab.
+        int32 start_scanline;
+        if (isOutsideSlab(v1, v2, v3, start_scanline)) {
+            return;
+        }
+        start_scanline = std::max(start_scanline, data.slab_start);
+
+        // Both triangles from clipping get records of their own, so that each is set up at its own start scanline.
+        if (data.num_records >= data.max_num_records) {
+            // End slab before the triangle, which is recorded again for the next slab. If the slab cannot shrink any
+            // further, the triangle is lost.
+            ++data.num_overflows;
+            MICRORENDERER_COUNT(triangles_dropped, start_scanline <= data.slab_start);
+            data.slab_end = std::max(start_scanline - 1, data.slab_start);
+            return;
+        }
+
+        // Store triangle record and add entry to rasterization order.
+        const uint16 record_idx = data.num_records;
+        data.records[record_idx] = {data.instance_idx_marker, static_cast<uint16>(tri_idx), static_cast<int16>(start_scanline),
+                                    clip_half};
+        data.order[record_idx] = {static_cast<int16>(start_scanline), record_idx};
+        ++data.num_records;
+    }
     else if constexpr (t_cfg.render_mode == SCANLINE) {
+        // Skip triangles outside of the current slab.
+        int32 start_scanline;
+        if (isOutsideSlab(v1, v2, v3, start_scanline)) {
+            return;
+        }
+
         // Get reference to next entry in stored rasterization buffers if not full.
         if (scanline_render_data.num_buffers >= scanline_render_data.max_num_buffers) {
+            // End slab before the triangle, which is processed again for the next slab. If the slab cannot shrink any
+            // further, the triangle is lost.
+            ++scanline_render_data.num_overflows;
+            MICRORENDERER_COUNT(triangles_dropped, start_scanline <= scanline_render_data.slab_start);
+            scanline_render_data.slab_end = std::max(start_scanline - 1, scanline_render_data.slab_start);
             return;
         }
         uint16 buffer_idx = scanline_render_data.num_buffers;
         RasterizationBuffer& rasterization = scanline_render_data.buffers[buffer_idx];
 
         // Setup triangle and rasterization.
-        int32 start_scanline;
-        if (setupTriangleRasterization(tri_idx, v1, v2, v3, rasterization, start_scanline)) {
-            // Store instance reference in rasterization buffer.
+        if (setupTriangleRasterization(tri_idx, v1, v2, v3, rasterization, start_scanline) &&
+            advanceToSlab(rasterization, start_scanline)) {
+            // Store instance reference and start scanline in rasterization buffer.
             rasterization.instance_idx = scanline_render_data.instance_idx_marker;
+            rasterization.start_scanline = static_cast<int16>(start_scanline);
 
             // Add entry to stored rasterization order.
             RasterizationOrder& order = scanline_render_data.order[buffer_idx];
@@ -781,6 +2135,79 @@ void Renderer<T, t_cfg, ShaderProgram>::processTriangle(uint32 tri_idx, VertexDa
             ++scanline_render_data.num_buffers;
         }
     }
+    else if constexpr (t_cfg.render_mode == TILED) {
+        // Get reference to next entry in stored rasterization buffers if not full.
+        if (tiled_render_data.num_buffers >= tiled_render_data.max_num_buffers) {
+            MICRORENDERER_COUNT(triangles_dropped, 1);
+            return;
+        }
+        uint16 buffer_idx = tiled_render_data.num_buffers;
+        RasterizationBuffer& rasterization = tiled_render_data.buffers[buffer_idx];
+
+        // Setup triangle and rasterization.
+        int32 start_scanline;
+        if (setupTriangleRasterization(tri_idx, v1, v2, v3, rasterization, start_scanline)) {
+            // Store instance reference and start scanline in rasterization buffer.
+            rasterization.instance_idx = tiled_render_data.instance_idx_marker;
+            rasterization.start_scanline = static_cast<int16>(start_scanline);
+
+            // Add triangle to all tiles it overlaps and increment used rasterization buffers counter.
+            if (binTriangle(rasterization, buffer_idx, v1, v2, v3)) {
+                ++tiled_render_data.num_buffers;
+            }
+        }
+    }
+}
+
+template <typename T, RendererConfiguration t_cfg, template <typename, ShaderConfiguration> class ShaderProgram>
+bool Renderer<T, t_cfg, ShaderProgram>::binTriangle(const RasterizationBuffer& rasterization, uint16 buffer_idx,
+                                                    const VertexData& v1, const VertexData& v2,
+                                                    const VertexData& v3) requires(t_cfg.render_mode == TILED)
+{
+    TiledRenderData& data = tiled_render_data;
+    const Vector3<T>& pos_1 = v1.buffer->screen_position;
+    const Vector3<T>& pos_2 = v2.buffer->screen_position;
+    const Vector3<T>& pos_3 = v3.buffer->screen_position;
+
+    // Compute screen bounding box of triangle.
+    const T min_x = std::min(std::min(pos_1.x, pos_2.x), pos_3.x);
+    const T max_x = std::max(std::max(pos_1.x, pos_2.x), pos_3.x);
+    const int32 x_start = std::max(static_cast<int32>(floor(min_x)), static_cast<int32>(0));
+    const int32 x_end = std::min(static_cast<int32>(ceil(max_x)), width_minus_one);
+    const int32 y_start = static_cast<int32>(rasterization.start_scanline);
+    const int32 y_end = std::min(static_cast<int32>(rasterization.y_fulltri_end), height_minus_one);
+    if (x_start > x_end || y_start > y_end) {
+        // Triangle is fully outside screen.
+        return false;
+    }
+
+    // Compute overlapped tiles and check if enough bin entries are left.
+    const int32 tile_x_start = x_start / tile_size;
+    const int32 tile_x_end = x_end / tile_size;
+    const int32 tile_y_start = y_start / tile_size;
+    const int32 tile_y_end = y_end / tile_size;
+    const uint32 num_overlapped = static_cast<uint32>((tile_x_end - tile_x_start + 1) * (tile_y_end - tile_y_start + 1));
+    if (data.num_entries + num_overlapped > data.max_num_entries) {
+        MICRORENDERER_COUNT(triangles_dropped, 1);
+        return false;
+    }
+
+    // Append triangle to bins of overlapped tiles.
+    for (int32 tile_y = tile_y_start; tile_y <= tile_y_end; ++tile_y) {
+        for (int32 tile_x = tile_x_start; tile_x <= tile_x_end; ++tile_x) {
+            TileBin& bin = data.bins[tile_x + tile_y * data.num_tiles_x];
+            const uint32 entry_idx = data.num_entries++;
+            data.entries[entry_idx] = {buffer_idx, TILE_BIN_END};
+            if (bin.first_entry == TILE_BIN_END) {
+                bin.first_entry = entry_idx;
+            }
+            else {
+                data.entries[bin.last_entry].next_entry = entry_idx;
+            }
+            bin.last_entry = entry_idx;
+        }
+    }
+    return true;
 }
 
 } // namespace MicroRenderer
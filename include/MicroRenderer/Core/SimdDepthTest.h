@@ -0,0 +1,108 @@
+#pragma once
+#include <type_traits>
+#include "MicroRenderer/Math/ScalarTypes.h"
+#if defined(__AVX__) || defined(__SSE2__)
+#include <immintrin.h>
+#elif defined(__ARM_NEON)
+#include <arm_neon.h>
+#endif
+
+namespace MicroRenderer {
+
+// Number of pixels depth-tested at once for scalar type T, 1 if the target has no suitable vector instructions.
+template<typename T>
+constexpr int32 depth_test_lanes = 1;
+
+#if defined(__AVX__)
+template<>
+constexpr int32 depth_test_lanes<float> = 8;
+template<>
+constexpr int32 depth_test_lanes<double> = 4;
+#elif defined(__SSE2__)
+template<>
+constexpr int32 depth_test_lanes<float> = 4;
+template<>
+constexpr int32 depth_test_lanes<double> = 2;
+#elif defined(__ARM_NEON)
+template<>
+constexpr int32 depth_test_lanes<float> = 4;
+#if defined(__aarch64__)
+template<>
+constexpr int32 depth_test_lanes<double> = 2;
+#endif
+#endif
+
+// Reversed-z depth test of depth_test_lanes<T> consecutive pixels of a depthbuffer row, lane k holding the depth
+// value + k * increment. Stores the depth of passing lanes and returns their bit mask, lane k in bit k.
+template<typename T>
+uint32 depthTestLanes(T* depth_row, T value, T increment)
+{
+#if defined(__AVX__)
+    if constexpr (std::is_same_v<T, float>) {
+        const __m256 lane_offsets = _mm256_setr_ps(0.f, 1.f, 2.f, 3.f, 4.f, 5.f, 6.f, 7.f);
+        const __m256 depth = _mm256_add_ps(_mm256_set1_ps(value), _mm256_mul_ps(_mm256_set1_ps(increment), lane_offsets));
+        const __m256 stored = _mm256_loadu_ps(depth_row);
+        const __m256 pass = _mm256_cmp_ps(depth, stored, _CMP_GT_OQ);
+        _mm256_storeu_ps(depth_row, _mm256_blendv_ps(stored, depth, pass));
+        return static_cast<uint32>(_mm256_movemask_ps(pass));
+    }
+    else if constexpr (std::is_same_v<T, double>) {
+        const __m256d lane_offsets = _mm256_setr_pd(0.0, 1.0, 2.0, 3.0);
+        const __m256d depth = _mm256_add_pd(_mm256_set1_pd(value), _mm256_mul_pd(_mm256_set1_pd(increment), lane_offsets));
+        const __m256d stored = _mm256_loadu_pd(depth_row);
+        const __m256d pass = _mm256_cmp_pd(depth, stored, _CMP_GT_OQ);
+        _mm256_storeu_pd(depth_row, _mm256_blendv_pd(stored, depth, pass));
+        return static_cast<uint32>(_mm256_movemask_pd(pass));
+    }
+    else
+#elif defined(__SSE2__)
+    if constexpr (std::is_same_v<T, float>) {
+        const __m128 lane_offsets = _mm_setr_ps(0.f, 1.f, 2.f, 3.f);
+        const __m128 depth = _mm_add_ps(_mm_set1_ps(value), _mm_mul_ps(_mm_set1_ps(increment), lane_offsets));
+        const __m128 stored = _mm_loadu_ps(depth_row);
+        const __m128 pass = _mm_cmpgt_ps(depth, stored);
+        _mm_storeu_ps(depth_row, _mm_or_ps(_mm_and_ps(pass, depth), _mm_andnot_ps(pass, stored)));
+        return static_cast<uint32>(_mm_movemask_ps(pass));
+    }
+    else if constexpr (std::is_same_v<T, double>) {
+        const __m128d lane_offsets = _mm_setr_pd(0.0, 1.0);
+        const __m128d depth = _mm_add_pd(_mm_set1_pd(value), _mm_mul_pd(_mm_set1_pd(increment), lane_offsets));
+        const __m128d stored = _mm_loadu_pd(depth_row);
+        const __m128d pass = _mm_cmpgt_pd(depth, stored);
+        _mm_storeu_pd(depth_row, _mm_or_pd(_mm_and_pd(pass, depth), _mm_andnot_pd(pass, stored)));
+        return static_cast<uint32>(_mm_movemask_pd(pass));
+    }
+    else
+#elif defined(__ARM_NEON)
+    if constexpr (std::is_same_v<T, float>) {
+        const float lane_offset_values[4] = {0.f, 1.f, 2.f, 3.f};
+        const uint32 lane_bit_values[4] = {1, 2, 4, 8};
+        const float32x4_t depth = vmlaq_n_f32(vdupq_n_f32(value), vld1q_f32(lane_offset_values), increment);
+        const float32x4_t stored = vld1q_f32(depth_row);
+        const uint32x4_t pass = vcgtq_f32(depth, stored);
+        vst1q_f32(depth_row, vbslq_f32(pass, depth, stored));
+        const uint32x4_t bits = vandq_u32(pass, vld1q_u32(lane_bit_values));
+        const uint32x2_t pair_sums = vadd_u32(vget_low_u32(bits), vget_high_u32(bits));
+        return vget_lane_u32(vpadd_u32(pair_sums, pair_sums), 0);
+    }
+#if defined(__aarch64__)
+    else if constexpr (std::is_same_v<T, double>) {
+        const float64x2_t depth = vaddq_f64(vdupq_n_f64(value), vsetq_lane_f64(increment, vdupq_n_f64(0.0), 1));
+        const float64x2_t stored = vld1q_f64(depth_row);
+        const uint64x2_t pass = vcgtq_f64(depth, stored);
+        vst1q_f64(depth_row, vbslq_f64(pass, depth, stored));
+        return static_cast<uint32>((vgetq_lane_u64(pass, 0) & 1) | (vgetq_lane_u64(pass, 1) & 2));
+    }
+#endif
+    else
+#endif
+    {
+        if (value > *depth_row) {
+            *depth_row = value;
+            return 1;
+        }
+        return 0;
+    }
+}
+
+} // namespace MicroRenderer
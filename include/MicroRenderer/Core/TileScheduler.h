@@ -0,0 +1,189 @@
+#pragma once
+#include <atomic>
+#include <cassert>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#include "MicroRenderer/Math/ScalarTypes.h"
+
+namespace MicroRenderer {
+
+// Pool of worker threads shading screen tiles in parallel. Tiles are distributed evenly to all threads up front, a
+// thread that runs out of tiles steals from the back of another thread's queue.
+class TileScheduler
+{
+public:
+    static constexpr uint32 MAX_NUM_THREADS = 64;
+
+    // The calling thread of execute() counts as one of num_threads.
+    explicit TileScheduler(uint32 num_threads)
+    {
+        assert(num_threads >= 1 && num_threads <= MAX_NUM_THREADS);
+        this->num_threads = num_threads;
+        for (uint32 thread_idx = 1; thread_idx < num_threads; ++thread_idx) {
+            threads[thread_idx - 1] = std::thread(&TileScheduler::workerLoop, this, thread_idx);
+        }
+    }
+
+    ~TileScheduler()
+    {
+        {
+            std::lock_guard lock(mutex);
+            shutdown = true;
+        }
+        start_condition.notify_all();
+        for (uint32 thread_idx = 1; thread_idx < num_threads; ++thread_idx) {
+            threads[thread_idx - 1].join();
+        }
+    }
+
+    TileScheduler(const TileScheduler&) = delete;
+
+    TileScheduler& operator=(const TileScheduler&) = delete;
+
+    uint32 getNumThreads() const
+    {
+        return num_threads;
+    }
+
+    // Distributes tiles [0, num_tiles) to all threads and calls function(thread_idx) once on each of them, the calling
+    // thread being thread 0. Returns after all calls have returned.
+    template<typename Function>
+    void execute(uint32 num_tiles, Function& function)
+    {
+        // Split tiles into contiguous ranges, one per thread.
+        for (uint32 thread_idx = 0; thread_idx < num_threads; ++thread_idx) {
+            const uint64 begin = static_cast<uint64>(num_tiles) * thread_idx / num_threads;
+            const uint64 end = static_cast<uint64>(num_tiles) * (thread_idx + 1) / num_threads;
+            queues[thread_idx].range.store((begin << 32) | end, std::memory_order_relaxed);
+        }
+
+        // Wake up worker threads.
+        {
+            std::lock_guard lock(mutex);
+            task_context = &function;
+            task_function = [](void* context, uint32 thread_idx) {
+                (*static_cast<Function*>(context))(thread_idx);
+            };
+            num_running = num_threads - 1;
+            ++generation;
+        }
+        start_condition.notify_all();
+
+        // Participate as thread 0 and wait for worker threads to finish.
+        function(0);
+        std::unique_lock lock(mutex);
+        done_condition.wait(lock, [this] { return num_running == 0; });
+    }
+
+    // Pops the next tile from the front of the thread's own queue or, if empty, steals one from the back of another.
+    bool acquireTile(uint32 thread_idx, uint32& tile_idx)
+    {
+        if (popFront(queues[thread_idx], tile_idx)) {
+            return true;
+        }
+        for (uint32 offset = 1; offset < num_threads; ++offset) {
+            uint32 victim_idx = thread_idx + offset;
+            if (victim_idx >= num_threads) {
+                victim_idx -= num_threads;
+            }
+            if (popBack(queues[victim_idx], tile_idx)) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+private:
+    // Remaining tiles [begin, end) of a thread, packed as (begin << 32) | end to be updated atomically.
+    struct alignas(64) TileQueue
+    {
+        std::atomic<uint64> range{0};
+    };
+
+    static bool popFront(TileQueue& queue, uint32& tile_idx)
+    {
+        uint64 range = queue.range.load(std::memory_order_relaxed);
+        while (true) {
+            const auto begin = static_cast<uint32>(range >> 32);
+            const auto end = static_cast<uint32>(range);
+            if (begin >= end) {
+                return false;
+            }
+            const uint64 new_range = (static_cast<uint64>(begin + 1) << 32) | end;
+            if (queue.range.compare_exchange_weak(range, new_range, std::memory_order_relaxed)) {
+                tile_idx = begin;
+                return true;
+            }
+        }
+    }
+
+    static bool popBack(TileQueue& queue, uint32& tile_idx)
+    {
+        uint64 range = queue.range.load(std::memory_order_relaxed);
+        while (true) {
+            const auto begin = static_cast<uint32>(range >> 32);
+            const auto end = static_cast<uint32>(range);
+            if (begin >= end) {
+                return false;
+            }
+            const uint64 new_range = (static_cast<uint64>(begin) << 32) | (end - 1);
+            if (queue.range.compare_exchange_weak(range, new_range, std::memory_order_relaxed)) {
+                tile_idx = end - 1;
+                return true;
+            }
+        }
+    }
+
+    void workerLoop(uint32 thread_idx)
+    {
+        uint32 seen_generation = 0;
+        while (true) {
+            // Wait for next task.
+            void (*function)(void*, uint32);
+            void* context;
+            {
+                std::unique_lock lock(mutex);
+                start_condition.wait(lock, [this, seen_generation] { return shutdown || generation != seen_generation; });
+                if (shutdown) {
+                    return;
+                }
+                seen_generation = generation;
+                function = task_function;
+                context = task_context;
+            }
+
+            function(context, thread_idx);
+
+            // Signal completion.
+            std::lock_guard lock(mutex);
+            if (--num_running == 0) {
+                done_condition.notify_one();
+            }
+        }
+    }
+
+    uint32 num_threads = 1;
+
+    TileQueue queues[MAX_NUM_THREADS];
+
+    std::thread threads[MAX_NUM_THREADS - 1];
+
+    std::mutex mutex;
+
+    std::condition_variable start_condition;
+
+    std::condition_variable done_condition;
+
+    uint32 generation = 0;
+
+    uint32 num_running = 0;
+
+    bool shutdown = false;
+
+    void (*task_function)(void*, uint32) = nullptr;
+
+    void* task_context = nullptr;
+};
+
+} // namespace MicroRenderer
@@ -0,0 +1,258 @@
+#pragma once
+#include <cassert>
+#include <compare>
+#include <limits>
+#include <type_traits>
+#include <utility>
+#include "ScalarMath.h"
+#include "ScalarTypes.h"
+
+namespace MicroRenderer {
+
+// Signed fixed-point number with frac_bits fractional bits stored in StorageType (int32 or int64), e.g. Q16.16 as
+// FixedPoint<16>. Products and quotients are computed in twice the storage width, products round towards negative
+// infinity and quotients towards zero.
+// Note: screen-space setup multiplies pixel coordinates, e.g. a triangle's area is the product of two edge lengths, so
+// the integer range must cover the squared edge length of the largest triangle on screen. Q16.16 covers edges of up to
+// 181 pixels, Q20.12 up to 724 pixels and int64 formats any practical resolution.
+// Note: Transform relies on floating-point trigonometry, build matrices in float/double and convert them.
+template<uint32 frac_bits, typename StorageType = int32>
+class FixedPoint {
+public:
+    static_assert(std::is_same_v<StorageType, int32> || std::is_same_v<StorageType, int64>,
+                  "Storage type of FixedPoint must be int32 or int64!");
+    static_assert(frac_bits > 0 && frac_bits < sizeof(StorageType) * 8 - 1,
+                  "Number of fractional bits of FixedPoint must leave room for sign and integer bits!");
+
+    static constexpr StorageType ONE = static_cast<StorageType>(1) << frac_bits;
+
+    // Raw two's complement representation, value * 2^frac_bits.
+    StorageType raw;
+
+    FixedPoint() = default;
+
+    template<typename U> requires std::is_integral_v<U>
+    constexpr FixedPoint(U value) : raw(static_cast<StorageType>(static_cast<StorageType>(value) * ONE))
+    {
+        assert(std::cmp_greater_equal(value, std::numeric_limits<StorageType>::min() >> frac_bits) &&
+               std::cmp_less_equal(value, std::numeric_limits<StorageType>::max() >> frac_bits));
+    }
+
+    template<typename U> requires std::is_floating_point_v<U>
+    constexpr FixedPoint(U value)
+        : raw(static_cast<StorageType>(value * static_cast<U>(ONE) + (value < 0 ? static_cast<U>(-0.5) : static_cast<U>(0.5)))) {}
+
+    // Conversion between formats truncates surplus fractional bits.
+    template<uint32 other_frac_bits, typename OtherStorageType>
+    explicit constexpr FixedPoint(FixedPoint<other_frac_bits, OtherStorageType> other)
+    {
+        if constexpr (other_frac_bits >= frac_bits) {
+            raw = static_cast<StorageType>(other.raw >> (other_frac_bits - frac_bits));
+        }
+        else {
+            raw = static_cast<StorageType>(static_cast<StorageType>(other.raw) * (static_cast<StorageType>(1) << (frac_bits - other_frac_bits)));
+        }
+    }
+
+    static constexpr FixedPoint fromRaw(StorageType raw)
+    {
+        FixedPoint result;
+        result.raw = raw;
+        return result;
+    }
+
+    // Conversion to integral types truncates towards zero like a floating-point to integer conversion.
+    template<typename U> requires std::is_integral_v<U> && (!std::is_same_v<U, bool>)
+    explicit constexpr operator U() const
+    {
+        return static_cast<U>(raw / ONE);
+    }
+
+    template<typename U> requires std::is_floating_point_v<U>
+    explicit constexpr operator U() const
+    {
+        return static_cast<U>(raw) / static_cast<U>(ONE);
+    }
+
+    constexpr FixedPoint operator-() const
+    {
+        return fromRaw(-raw);
+    }
+
+    constexpr FixedPoint& operator+=(FixedPoint other)
+    {
+        raw += other.raw;
+        return *this;
+    }
+
+    constexpr FixedPoint& operator-=(FixedPoint other)
+    {
+        raw -= other.raw;
+        return *this;
+    }
+
+    constexpr FixedPoint& operator*=(FixedPoint other)
+    {
+        raw = multiply(raw, other.raw);
+        return *this;
+    }
+
+    constexpr FixedPoint& operator/=(FixedPoint other)
+    {
+        raw = divide(raw, other.raw);
+        return *this;
+    }
+
+    friend constexpr FixedPoint operator+(FixedPoint a, FixedPoint b)
+    {
+        return a += b;
+    }
+
+    friend constexpr FixedPoint operator-(FixedPoint a, FixedPoint b)
+    {
+        return a -= b;
+    }
+
+    friend constexpr FixedPoint operator*(FixedPoint a, FixedPoint b)
+    {
+        return a *= b;
+    }
+
+    friend constexpr FixedPoint operator/(FixedPoint a, FixedPoint b)
+    {
+        return a /= b;
+    }
+
+    friend constexpr bool operator==(const FixedPoint& a, const FixedPoint& b) = default;
+
+    friend constexpr auto operator<=>(const FixedPoint& a, const FixedPoint& b) = default;
+
+    friend constexpr FixedPoint abs(FixedPoint value)
+    {
+        return value.raw < 0 ? -value : value;
+    }
+
+    friend constexpr FixedPoint floor(FixedPoint value)
+    {
+        return fromRaw(value.raw & ~(ONE - 1));
+    }
+
+    friend constexpr FixedPoint ceil(FixedPoint value)
+    {
+        return fromRaw((value.raw + (ONE - 1)) & ~(ONE - 1));
+    }
+
+    // Rounds half away from zero like std::round.
+    friend constexpr FixedPoint round(FixedPoint value)
+    {
+        return value.raw < 0 ? -floor(fromRaw(-value.raw + ONE / 2)) : floor(fromRaw(value.raw + ONE / 2));
+    }
+
+    friend constexpr long lround(FixedPoint value)
+    {
+        return static_cast<long>(round(value).raw / ONE);
+    }
+
+    friend constexpr int floorToInt(FixedPoint value)
+    {
+        return static_cast<int>(value.raw >> frac_bits);
+    }
+
+    // Newton iteration from above, returns 0 for negative values.
+    friend constexpr FixedPoint sqrt(FixedPoint value)
+    {
+        if (value.raw <= 0) {
+            return fromRaw(0);
+        }
+        // Initial guess 2^ceil(bits(raw * 2^frac_bits) / 2) is larger than the root.
+        uint32 num_bits = frac_bits;
+        for (StorageType remaining = value.raw; remaining != 0; remaining >>= 1) {
+            ++num_bits;
+        }
+        const uint32 guess_bits = (num_bits + 1) / 2;
+        FixedPoint root = fromRaw(guess_bits < sizeof(StorageType) * 8 - 1 ? static_cast<StorageType>(1) << guess_bits
+                                                                              : value.raw);
+        while (true) {
+            const FixedPoint next = fromRaw((root.raw + divide(value.raw, root.raw)) / 2);
+            if (next.raw >= root.raw) {
+                return root;
+            }
+            root = next;
+        }
+    }
+
+private:
+    static constexpr StorageType multiply(StorageType a, StorageType b)
+    {
+        if constexpr (std::is_same_v<StorageType, int32>) {
+            return static_cast<int32>((static_cast<int64>(a) * b) >> frac_bits);
+        }
+        else {
+#ifdef __SIZEOF_INT128__
+            return static_cast<int64>((static_cast<__int128>(a) * b) >> frac_bits);
+#else
+            // 64x64 -> 128 bit product of magnitudes from 32 bit halves.
+            const bool negative = (a < 0) != (b < 0);
+            const uint64 a_abs = a < 0 ? 0 - static_cast<uint64>(a) : static_cast<uint64>(a);
+            const uint64 b_abs = b < 0 ? 0 - static_cast<uint64>(b) : static_cast<uint64>(b);
+            const uint64 a_lo = a_abs & 0xFFFFFFFF, a_hi = a_abs >> 32;
+            const uint64 b_lo = b_abs & 0xFFFFFFFF, b_hi = b_abs >> 32;
+            const uint64 lo_lo = a_lo * b_lo;
+            const uint64 mid = (lo_lo >> 32) + (a_hi * b_lo & 0xFFFFFFFF) + (a_lo * b_hi & 0xFFFFFFFF);
+            const uint64 low = (mid << 32) | (lo_lo & 0xFFFFFFFF);
+            const uint64 high = a_hi * b_hi + (a_hi * b_lo >> 32) + (a_lo * b_hi >> 32) + (mid >> 32);
+            const uint64 result = (high << (64 - frac_bits)) | (low >> frac_bits);
+            // Round negative results towards negative infinity like the arithmetic shift above.
+            const bool inexact = (low & (ONE - 1)) != 0;
+            return negative ? -static_cast<int64>(result + inexact) : static_cast<int64>(result);
+#endif
+        }
+    }
+
+    static constexpr StorageType divide(StorageType a, StorageType b)
+    {
+        if constexpr (std::is_same_v<StorageType, int32>) {
+            return static_cast<int32>((static_cast<int64>(a) * ONE) / b);
+        }
+        else {
+#ifdef __SIZEOF_INT128__
+            return static_cast<int64>((static_cast<__int128>(a) * ONE) / b);
+#else
+            // Integer part directly, fractional bits by restoring long division of the remainder.
+            const bool negative = (a < 0) != (b < 0);
+            const uint64 a_abs = a < 0 ? 0 - static_cast<uint64>(a) : static_cast<uint64>(a);
+            const uint64 b_abs = b < 0 ? 0 - static_cast<uint64>(b) : static_cast<uint64>(b);
+            uint64 result = a_abs / b_abs;
+            uint64 remainder = a_abs % b_abs;
+            for (uint32 bit = 0; bit < frac_bits; ++bit) {
+                const bool overflow = remainder >> 63;
+                remainder <<= 1;
+                result <<= 1;
+                if (overflow || remainder >= b_abs) {
+                    remainder -= b_abs;
+                    result |= 1;
+                }
+            }
+            return negative ? -static_cast<int64>(result) : static_cast<int64>(result);
+#endif
+        }
+    }
+};
+
+template<uint32 frac_bits, typename StorageType>
+constexpr bool is_render_scalar_v<FixedPoint<frac_bits, StorageType>> = true;
+
+// int64 formats narrow to int32 storage with at most 24 fractional bits, leaving a range of at least +-128.
+template<uint32 frac_bits>
+struct NarrowScalar<FixedPoint<frac_bits, int64>>
+{
+    using type = FixedPoint<(frac_bits < 24 ? frac_bits : 24)>;
+};
+
+template<typename T>
+constexpr bool is_fixed_point_v = false;
+
+template<uint32 frac_bits, typename StorageType>
+constexpr bool is_fixed_point_v<FixedPoint<frac_bits, StorageType>> = true;
+
+} // namespace MicroRenderer
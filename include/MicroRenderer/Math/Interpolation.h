@@ -3,7 +3,11 @@
 //
 
 #pragma once
+#include <tuple>
+#include <utility>
 #include "MicroRenderer/Math/Vector2.h"
+#include "MicroRenderer/Math/Vector3.h"
+#include "MicroRenderer/Math/Vector4.h"
 
 namespace MicroRenderer {
 
@@ -29,12 +33,12 @@ template<typename T>
 void computeBarycentricIncrements(const Vector2<T>& pos_1, const Vector2<T>& pos_2, const Vector2<T>& pos_3,
                                   BarycentricIncrements<T>& bc_incs)
 {
-    const T alpha_signed_dist = (pos_2.y - pos_3.y) * pos_1.x + (pos_3.x - pos_2.x) * pos_1.y + pos_2.x * pos_3.y - pos_3.x * pos_2.y;
-    bc_incs.alpha = {(pos_2.y - pos_3.y) / alpha_signed_dist, (pos_3.x - pos_2.x) / alpha_signed_dist};
-    const T beta_signed_dist = (pos_3.y - pos_1.y) * pos_2.x + (pos_1.x - pos_3.x) * pos_2.y + pos_3.x * pos_1.y - pos_1.x * pos_3.y;
-    bc_incs.beta = {(pos_3.y - pos_1.y) / beta_signed_dist, (pos_1.x - pos_3.x) / beta_signed_dist};
-    const T gamma_signed_dist = (pos_1.y - pos_2.y) * pos_3.x + (pos_2.x - pos_1.x) * pos_3.y + pos_1.x * pos_2.y - pos_2.x * pos_1.y;
-    bc_incs.gamma = {(pos_1.y - pos_2.y) / gamma_signed_dist, (pos_2.x - pos_1.x) / gamma_signed_dist};
+    // Signed distance of each vertex to its opposite edge, which is twice the signed triangle area for all three. Edge
+    // vectors keep the products small, so fixed-point types do not overflow on absolute screen coordinates.
+    const T signed_dist = (pos_2.y - pos_3.y) * (pos_1.x - pos_3.x) + (pos_3.x - pos_2.x) * (pos_1.y - pos_3.y);
+    bc_incs.alpha = {(pos_2.y - pos_3.y) / signed_dist, (pos_3.x - pos_2.x) / signed_dist};
+    bc_incs.beta = {(pos_3.y - pos_1.y) / signed_dist, (pos_1.x - pos_3.x) / signed_dist};
+    bc_incs.gamma = {(pos_1.y - pos_2.y) / signed_dist, (pos_2.x - pos_1.x) / signed_dist};
 }
 
 enum class IncrementationMode : uint32
@@ -45,92 +49,274 @@ enum class IncrementationMode : uint32
     OffsetInY
 };
 
-template<typename T, typename AttrType>
+// Interpolates an attribute linearly across a triangle. Increments are stored as IncrementType, which may be narrower
+// than AttrType to shrink triangle buffers, while the current value is accumulated in AttrType.
+template<typename T, typename AttrType, typename IncrementType = AttrType>
 class TriangleAttribute
 {
 public:
     void initialize(const AttrType& v1, const AttrType& v2, const AttrType& v3, const BarycentricIncrements<T>& bc_incs,
                     const Vector2<T>& offset)
     {
-        increment_x = v1 * bc_incs.alpha.x + v2 * bc_incs.beta.x + v3 * bc_incs.gamma.x;
-        increment_y = v1 * bc_incs.alpha.y + v2 * bc_incs.beta.y + v3 * bc_incs.gamma.y;
-        current_value = v1 + increment_x * offset.x + increment_y * offset.y;
+        const AttrType wide_increment_x = v1 * bc_incs.alpha.x + v2 * bc_incs.beta.x + v3 * bc_incs.gamma.x;
+        const AttrType wide_increment_y = v1 * bc_incs.alpha.y + v2 * bc_incs.beta.y + v3 * bc_incs.gamma.y;
+        current_value = v1 + wide_increment_x * offset.x + wide_increment_y * offset.y;
+        increment_x = static_cast<IncrementType>(wide_increment_x);
+        increment_y = static_cast<IncrementType>(wide_increment_y);
     }
 
-    AttrType getValue()
+    AttrType getValue() const
     {
         return current_value;
     }
 
+    AttrType getIncrementX() const
+    {
+        return static_cast<AttrType>(increment_x);
+    }
+
     template<IncrementationMode mode>
     void increment(int32 offset = 1)
     {
         if constexpr(mode == IncrementationMode::OneInX) {
-            current_value += increment_x;
+            current_value += static_cast<AttrType>(increment_x);
         }
         else if constexpr(mode == IncrementationMode::OneInY) {
-            current_value += increment_y;
+            current_value += static_cast<AttrType>(increment_y);
         }
         else if constexpr(mode == IncrementationMode::OffsetInX) {
-            current_value += increment_x * static_cast<T>(offset);
+            current_value += static_cast<AttrType>(increment_x) * static_cast<T>(offset);
         }
         else if constexpr(mode == IncrementationMode::OffsetInY) {
-            current_value += increment_y * static_cast<T>(offset);
+            current_value += static_cast<AttrType>(increment_y) * static_cast<T>(offset);
         }
     }
 private:
     AttrType current_value;
-    AttrType increment_x;
-    AttrType increment_y;
+    IncrementType increment_x;
+    IncrementType increment_y;
 };
 
-// template<typename SourceType, typename WorkType> POSSIBLE_FEATURE: selectable float/fp and precision through RendererConfiguration
-// class TriangleAttribute
-// {
-// public:
-//     enum class IncrementationMode : uint32
-//     {
-//         OneInX,
-//         OneInY,
-//         OffsetInX,
-//         OffsetInY
-//     };
-//
-//     TriangleAttribute(const SourceType& v1, const SourceType& v2, const SourceType& v3,
-//                       const BarycentricIncrements<WorkType>& bc_incs, const Vector2<WorkType>& offset)
-//     {
-//         increment_x = static_cast<WorkType>(v1) * bc_incs.alpha.x + static_cast<WorkType>(v2) * bc_incs.beta.x +
-//                       static_cast<WorkType>(v3) * bc_incs.gamma.x;
-//         increment_y = static_cast<WorkType>(v1) * bc_incs.alpha.y + static_cast<WorkType>(v2) * bc_incs.beta.y +
-//                       static_cast<WorkType>(v3) * bc_incs.gamma.y;
-//         current_value = static_cast<WorkType>(v1) + increment_x * offset.x + increment_y * offset.y;
-//     }
-//
-//     SourceType getValue()
-//     {
-//         return static_cast<SourceType>(current_value);
-//     }
-//
-//     template<IncrementationMode mode>
-//     void increment(int32 offset = 1)
-//     {
-//         if constexpr(mode == IncrementationMode::OneInX) {
-//             current_value += increment_x;
-//         }
-//         else if constexpr(mode == IncrementationMode::OneInY) {
-//             current_value += increment_y;
-//         }
-//         else if constexpr(mode == IncrementationMode::OffsetInX) {
-//             current_value += increment_x * static_cast<WorkType>(offset);
-//         }
-//         else if constexpr(mode == IncrementationMode::OffsetInY) {
-//             current_value += increment_y * static_cast<WorkType>(offset);
-//         }
-//     }
-// private:
-//     WorkType current_value;
-//     WorkType increment_x;
-//     WorkType increment_y;
-// };
+// Attribute type with scalar components narrowed by NarrowScalar.
+template<typename AttrType>
+struct NarrowAttribute
+{
+    using type = NarrowScalar_t<AttrType>;
+};
+
+template<typename U>
+struct NarrowAttribute<Vector2<U>>
+{
+    using type = Vector2<NarrowScalar_t<U>>;
+};
+
+template<typename U>
+struct NarrowAttribute<Vector3<U>>
+{
+    using type = Vector3<NarrowScalar_t<U>>;
+};
+
+template<typename U>
+struct NarrowAttribute<Vector4<U>>
+{
+    using type = Vector4<NarrowScalar_t<U>>;
+};
+
+template<typename AttrType>
+using NarrowAttribute_t = typename NarrowAttribute<AttrType>::type;
+
+// Number of scalar components of an attribute type.
+template<typename AttrType>
+constexpr int32 attribute_components = 1;
+
+template<typename U>
+constexpr int32 attribute_components<Vector2<U>> = 2;
+
+template<typename U>
+constexpr int32 attribute_components<Vector3<U>> = 3;
+
+template<typename U>
+constexpr int32 attribute_components<Vector4<U>> = 4;
+
+// Interpolates a list of attributes across a triangle like TriangleAttribute, with the components of all attributes
+// packed into flat arrays. Setting up and incrementing all attributes are then single loops over num_components
+// scalars, which compilers can unroll and vectorize. Attributes are addressed by their index in AttrTypes, whose
+// components must be of type T. Increments are stored as IncrementScalar, which may be narrower than T.
+template<typename T, typename IncrementScalar, typename... AttrTypes>
+class PackedTriangleAttributes
+{
+    static_assert(sizeof...(AttrTypes) > 0, "PackedTriangleAttributes: At least one attribute is required!");
+    static constexpr int32 component_counts[] = {attribute_components<AttrTypes>...};
+public:
+    using VertexAttributes = std::tuple<AttrTypes...>;
+    template<int32 idx>
+    using AttributeType = std::tuple_element_t<idx, VertexAttributes>;
+
+    static constexpr int32 num_components = (attribute_components<AttrTypes> + ...);
+
+    // Index of the first component of attribute idx in the packed arrays.
+    template<int32 idx>
+    static constexpr int32 first_component = [] {
+        int32 first = 0;
+        for (int32 i = 0; i < idx; ++i) {
+            first += component_counts[i];
+        }
+        return first;
+    }();
+
+    void initialize(const VertexAttributes& v1, const VertexAttributes& v2, const VertexAttributes& v3,
+                    const BarycentricIncrements<T>& bc_incs, const Vector2<T>& offset)
+    {
+        T c1[num_components];
+        T c2[num_components];
+        T c3[num_components];
+        unpack(v1, c1, std::index_sequence_for<AttrTypes...>());
+        unpack(v2, c2, std::index_sequence_for<AttrTypes...>());
+        unpack(v3, c3, std::index_sequence_for<AttrTypes...>());
+        initializeComponents(c1, c2, c3, bc_incs, offset);
+    }
+
+    // Sets up the attributes of each vertex multiplied by its weight, e.g. 1 / w for perspective correction.
+    void initialize(const VertexAttributes& v1, const VertexAttributes& v2, const VertexAttributes& v3,
+                    const BarycentricIncrements<T>& bc_incs, const Vector2<T>& offset, const Vector3<T>& weights)
+    {
+        T c1[num_components];
+        T c2[num_components];
+        T c3[num_components];
+        unpack(v1, c1, std::index_sequence_for<AttrTypes...>());
+        unpack(v2, c2, std::index_sequence_for<AttrTypes...>());
+        unpack(v3, c3, std::index_sequence_for<AttrTypes...>());
+        for (int32 i = 0; i < num_components; ++i) {
+            c1[i] *= weights.x;
+            c2[i] *= weights.y;
+            c3[i] *= weights.z;
+        }
+        initializeComponents(c1, c2, c3, bc_incs, offset);
+    }
+
+    template<int32 idx>
+    AttributeType<idx> getValue() const
+    {
+        return pack<AttributeType<idx>>(values + first_component<idx>);
+    }
+
+    template<int32 idx>
+    AttributeType<idx> getIncrementX() const
+    {
+        return pack<AttributeType<idx>>(increments_x + first_component<idx>);
+    }
+
+    void scaleValues(T factor)
+    {
+        for (int32 i = 0; i < num_components; ++i) {
+            values[i] *= factor;
+        }
+    }
+
+    // Sets the increments in x to those interpolating linearly to the values of end, num_pixels = 1 / inv_num_pixels
+    // further.
+    void setLinearIncrementsX(const PackedTriangleAttributes& end, T inv_num_pixels)
+    {
+        for (int32 i = 0; i < num_components; ++i) {
+            increments_x[i] = static_cast<IncrementScalar>((end.values[i] - values[i]) * inv_num_pixels);
+        }
+    }
+
+    // Sets the values to those of source offset pixels further in x. Increments are left as they are, except that those
+    // in x are copied with copy_increments_x.
+    template<bool copy_increments_x>
+    void evaluateInX(const PackedTriangleAttributes& source, int32 offset)
+    {
+        for (int32 i = 0; i < num_components; ++i) {
+            values[i] = source.values[i] + static_cast<T>(source.increments_x[i]) * static_cast<T>(offset);
+            if constexpr (copy_increments_x) {
+                increments_x[i] = source.increments_x[i];
+            }
+        }
+    }
+
+    // Whether all increments in x are zero, e.g. for attributes constant per triangle.
+    bool isConstantInX() const
+    {
+        bool constant = true;
+        for (int32 i = 0; i < num_components; ++i) {
+            constant &= static_cast<T>(increments_x[i]) == static_cast<T>(0.0);
+        }
+        return constant;
+    }
+
+    template<IncrementationMode mode>
+    void increment(int32 offset = 1)
+    {
+        for (int32 i = 0; i < num_components; ++i) {
+            if constexpr(mode == IncrementationMode::OneInX) {
+                values[i] += static_cast<T>(increments_x[i]);
+            }
+            else if constexpr(mode == IncrementationMode::OneInY) {
+                values[i] += static_cast<T>(increments_y[i]);
+            }
+            else if constexpr(mode == IncrementationMode::OffsetInX) {
+                values[i] += static_cast<T>(increments_x[i]) * static_cast<T>(offset);
+            }
+            else if constexpr(mode == IncrementationMode::OffsetInY) {
+                values[i] += static_cast<T>(increments_y[i]) * static_cast<T>(offset);
+            }
+        }
+    }
+private:
+    void initializeComponents(const T* c1, const T* c2, const T* c3, const BarycentricIncrements<T>& bc_incs,
+                              const Vector2<T>& offset)
+    {
+        for (int32 i = 0; i < num_components; ++i) {
+            // Barycentric increments sum up to zero, so increments follow from the differences to the first vertex.
+            // Components equal at all vertices thereby get exact zero increments without comparing them.
+            const T delta_2 = c2[i] - c1[i];
+            const T delta_3 = c3[i] - c1[i];
+            const T wide_increment_x = delta_2 * bc_incs.beta.x + delta_3 * bc_incs.gamma.x;
+            const T wide_increment_y = delta_2 * bc_incs.beta.y + delta_3 * bc_incs.gamma.y;
+            values[i] = c1[i] + wide_increment_x * offset.x + wide_increment_y * offset.y;
+            increments_x[i] = static_cast<IncrementScalar>(wide_increment_x);
+            increments_y[i] = static_cast<IncrementScalar>(wide_increment_y);
+        }
+    }
+
+    template<size_t... idx>
+    static void unpack(const VertexAttributes& attributes, T* components, std::index_sequence<idx...>)
+    {
+        (unpackAttribute(std::get<idx>(attributes), components + first_component<idx>), ...);
+    }
+
+    template<typename AttrType>
+    static void unpackAttribute(const AttrType& attribute, T* components)
+    {
+        if constexpr (attribute_components<AttrType> == 1) {
+            components[0] = attribute;
+        }
+        else {
+            for (int32 i = 0; i < attribute_components<AttrType>; ++i) {
+                components[i] = attribute.components[i];
+            }
+        }
+    }
+
+    template<typename AttrType, typename Scalar>
+    static AttrType pack(const Scalar* components)
+    {
+        if constexpr (attribute_components<AttrType> == 1) {
+            return static_cast<T>(components[0]);
+        }
+        else {
+            AttrType attribute;
+            for (int32 i = 0; i < attribute_components<AttrType>; ++i) {
+                attribute.components[i] = static_cast<T>(components[i]);
+            }
+            return attribute;
+        }
+    }
+
+    T values[num_components];
+    IncrementScalar increments_x[num_components];
+    IncrementScalar increments_y[num_components];
+};
 
 } // namespace MicroRenderer
@@ -11,7 +11,7 @@ namespace MicroRenderer {
 template<typename T>
 class Matrix3 {
 public:
-    static_assert(std::is_arithmetic_v<T>, "Template type of Matrix3<T> must be arithmetic!");
+    static_assert(is_render_scalar_v<T>, "Template type of Matrix3<T> must be a scalar type!");
 
     // Component values.
     union {
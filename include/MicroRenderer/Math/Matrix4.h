@@ -5,6 +5,7 @@
 #pragma once
 #include "Matrix3.h"
 #include "Vector4.h"
+#include "VectorBatch.h"
 
 namespace MicroRenderer {
 
@@ -12,7 +13,7 @@ namespace MicroRenderer {
 template<typename T>
 class Matrix4 {
 public:
-    static_assert(std::is_arithmetic_v<T>, "Template type of Matrix4<T> must be arithmetic!");
+    static_assert(is_render_scalar_v<T>, "Template type of Matrix4<T> must be a scalar type!");
 
     // Component values.
     union {
@@ -177,6 +178,12 @@ public:
     }
     friend constexpr Matrix4 operator*(const Matrix4& lhs, const Matrix4& rhs) {
         Matrix4 result;
+        if constexpr (simd_vector_math<T>) {
+            if (!std::is_constant_evaluated()) {
+                multiplyMatrix4Float4(lhs.components, rhs.components, result.components);
+                return result;
+            }
+        }
         result[0][0] = rhs[0][0] * lhs[0][0] + rhs[0][1] * lhs[1][0] + rhs[0][2] * lhs[2][0] + rhs[0][3] * lhs[3][0];
         result[0][1] = rhs[0][0] * lhs[0][1] + rhs[0][1] * lhs[1][1] + rhs[0][2] * lhs[2][1] + rhs[0][3] * lhs[3][1];
         result[0][2] = rhs[0][0] * lhs[0][2] + rhs[0][1] * lhs[1][2] + rhs[0][2] * lhs[2][2] + rhs[0][3] * lhs[3][2];
@@ -199,6 +206,12 @@ public:
     // Matrix-vector multiplication operator.
     friend constexpr Vector4<T> operator*(const Matrix4& lhs, const Vector4<T>& rhs) {
         Vector4<T> result;
+        if constexpr (simd_vector_math<T>) {
+            if (!std::is_constant_evaluated()) {
+                transformFloat4(lhs.components, rhs.components, result.components);
+                return result;
+            }
+        }
         result[0] = rhs[0] * lhs[0][0] + rhs[1] * lhs[1][0] + rhs[2] * lhs[2][0] + rhs[3] * lhs[3][0];
         result[1] = rhs[0] * lhs[0][1] + rhs[1] * lhs[1][1] + rhs[2] * lhs[2][1] + rhs[3] * lhs[3][1];
         result[2] = rhs[0] * lhs[0][2] + rhs[1] * lhs[1][2] + rhs[2] * lhs[2][2] + rhs[3] * lhs[3][2];
@@ -239,6 +252,11 @@ public:
     // Return transpose of matrix.
     Matrix4 getTranspose() const
     {
+        if constexpr (simd_vector_math<T>) {
+            Matrix4 result;
+            transposeMatrix4Float4(components, result.components);
+            return result;
+        }
         return {
             components[0], components[4], components[8], components[12],
             components[1], components[5], components[9], components[13],
@@ -251,12 +269,33 @@ public:
     Vector4<T> transformPosition(const Vector3<T>& vector) const
     {
         Vector4<T> result;
+        if constexpr (simd_vector_math<T>) {
+            transformPositionFloat4(components, vector[0], vector[1], vector[2], result.components);
+            return result;
+        }
         result[0] = vector[0] * columns[0][0] + vector[1] * columns[1][0] + vector[2] * columns[2][0] + columns[3][0];
         result[1] = vector[0] * columns[0][1] + vector[1] * columns[1][1] + vector[2] * columns[2][1] + columns[3][1];
         result[2] = vector[0] * columns[0][2] + vector[1] * columns[1][2] + vector[2] * columns[2][2] + columns[3][2];
         result[3] = vector[0] * columns[0][3] + vector[1] * columns[1][3] + vector[2] * columns[2][3] + columns[3][3];
         return result;
     }
+
+    // Performs transformPosition on N vectors in structure-of-arrays form, lane by lane, which compilers can vectorize.
+    template<int32 N>
+    void transformPositions(const Vector3Batch<T, N>& vectors, Vector4Batch<T, N>& result) const
+    {
+        // Stores into the result can not alias a local copy of the matrix.
+        const Matrix4 m = *this;
+        for (int32 lane = 0; lane < N; ++lane) {
+            const T x = vectors.x[lane];
+            const T y = vectors.y[lane];
+            const T z = vectors.z[lane];
+            result.x[lane] = x * m.columns[0][0] + y * m.columns[1][0] + z * m.columns[2][0] + m.columns[3][0];
+            result.y[lane] = x * m.columns[0][1] + y * m.columns[1][1] + z * m.columns[2][1] + m.columns[3][1];
+            result.z[lane] = x * m.columns[0][2] + y * m.columns[1][2] + z * m.columns[2][2] + m.columns[3][2];
+            result.w[lane] = x * m.columns[0][3] + y * m.columns[1][3] + z * m.columns[2][3] + m.columns[3][3];
+        }
+    }
 };
 
 typedef Matrix4<float> mat4;
@@ -0,0 +1,75 @@
+#pragma once
+#include <cmath>
+#include <type_traits>
+
+namespace MicroRenderer {
+
+// Scalar types usable in vectors, matrices, textures and the renderer. Specialized for non-arithmetic scalar types.
+template<typename T>
+constexpr bool is_render_scalar_v = std::is_arithmetic_v<T>;
+
+// Narrower scalar type to store values in that are not accumulated into, e.g. interpolation increments.
+template<typename T>
+struct NarrowScalar
+{
+    using type = T;
+};
+
+template<>
+struct NarrowScalar<double>
+{
+    using type = float;
+};
+
+template<typename T>
+using NarrowScalar_t = typename NarrowScalar<T>::type;
+
+// Rounding and root functions for arithmetic scalar types. Other scalar types provide overloads found by ADL, which
+// is why these are called unqualified throughout the library.
+
+template<typename T> requires std::is_arithmetic_v<T>
+T abs(T value)
+{
+    return std::abs(value);
+}
+
+template<typename T> requires std::is_arithmetic_v<T>
+T floor(T value)
+{
+    return std::floor(value);
+}
+
+template<typename T> requires std::is_arithmetic_v<T>
+T ceil(T value)
+{
+    return std::ceil(value);
+}
+
+template<typename T> requires std::is_arithmetic_v<T>
+T sqrt(T value)
+{
+    return std::sqrt(value);
+}
+
+template<typename T> requires std::is_arithmetic_v<T>
+T round(T value)
+{
+    return std::round(value);
+}
+
+template<typename T> requires std::is_arithmetic_v<T>
+long lround(T value)
+{
+    return std::lround(value);
+}
+
+// floor() converted to an integer. Corrects the truncating conversion instead of calling std::floor, so that loops over
+// it stay vectorizable.
+template<typename T> requires std::is_arithmetic_v<T>
+int floorToInt(T value)
+{
+    const int truncated = static_cast<int>(value);
+    return truncated - (static_cast<T>(truncated) > value ? 1 : 0);
+}
+
+} // namespace MicroRenderer
@@ -14,5 +14,7 @@ typedef uint16_t uint16;
 typedef int16_t int16;
 typedef uint32_t uint32;
 typedef int32_t int32;
+typedef uint64_t uint64;
+typedef int64_t int64;
 
 } // namespace MicroRenderer
@@ -0,0 +1,137 @@
+#pragma once
+#include <limits>
+#include "ScalarTypes.h"
+#ifdef MICRORENDERER_SIMD
+#if defined(__AVX__) || defined(__SSE__)
+#include <immintrin.h>
+#elif defined(__ARM_NEON)
+#include <arm_neon.h>
+#endif
+#endif
+
+namespace MicroRenderer {
+
+// Whether Vector4<T> and Matrix4<T> operations use vector instructions, only for float if MICRORENDERER_SIMD is
+// defined on SSE or NEON targets. Operations are carried out in the same order as the scalar code, so results are
+// identical unless the compiler contracts the scalar code into fused multiply-adds (e.g. with -mfma and the default
+// -ffp-contract=fast). Then they differ by rounding only, by at most simd_vector_math_tolerance times the sum of the
+// magnitudes of the products summed up.
+template<typename T>
+constexpr bool simd_vector_math = false;
+
+// Each of the up to 7 roundings of a sum of 4 products is below half an epsilon of that sum of magnitudes.
+constexpr float simd_vector_math_tolerance = 2 * 3.5f * std::numeric_limits<float>::epsilon();
+
+#if defined(MICRORENDERER_SIMD) && (defined(__SSE__) || defined(__ARM_NEON))
+template<>
+constexpr bool simd_vector_math<float> = true;
+
+// Four floats in a vector register.
+#if defined(__SSE__)
+using Float4 = __m128;
+
+inline Float4 loadFloat4(const float* values) { return _mm_loadu_ps(values); }
+inline void storeFloat4(float* values, Float4 vector) { _mm_storeu_ps(values, vector); }
+inline Float4 broadcastFloat4(float value) { return _mm_set1_ps(value); }
+inline Float4 addFloat4(Float4 lhs, Float4 rhs) { return _mm_add_ps(lhs, rhs); }
+inline Float4 subtractFloat4(Float4 lhs, Float4 rhs) { return _mm_sub_ps(lhs, rhs); }
+inline Float4 multiplyFloat4(Float4 lhs, Float4 rhs) { return _mm_mul_ps(lhs, rhs); }
+template<int32 lane>
+Float4 broadcastLaneFloat4(Float4 vector) { return _mm_shuffle_ps(vector, vector, _MM_SHUFFLE(lane, lane, lane, lane)); }
+#elif defined(__ARM_NEON)
+using Float4 = float32x4_t;
+
+inline Float4 loadFloat4(const float* values) { return vld1q_f32(values); }
+inline void storeFloat4(float* values, Float4 vector) { vst1q_f32(values, vector); }
+inline Float4 broadcastFloat4(float value) { return vdupq_n_f32(value); }
+inline Float4 addFloat4(Float4 lhs, Float4 rhs) { return vaddq_f32(lhs, rhs); }
+inline Float4 subtractFloat4(Float4 lhs, Float4 rhs) { return vsubq_f32(lhs, rhs); }
+inline Float4 multiplyFloat4(Float4 lhs, Float4 rhs) { return vmulq_f32(lhs, rhs); }
+template<int32 lane>
+Float4 broadcastLaneFloat4(Float4 vector) { return vdupq_laneq_f32(vector, lane); }
+#endif
+
+// Matrices are 16 floats in column-major order.
+
+// result = matrix * vector, i.e. the sum of the matrix's columns scaled by the vector's components.
+inline void transformFloat4(const float* matrix, const float* vector, float* result)
+{
+    const Float4 factors = loadFloat4(vector);
+    Float4 sum = multiplyFloat4(loadFloat4(matrix), broadcastLaneFloat4<0>(factors));
+    sum = addFloat4(sum, multiplyFloat4(loadFloat4(matrix + 4), broadcastLaneFloat4<1>(factors)));
+    sum = addFloat4(sum, multiplyFloat4(loadFloat4(matrix + 8), broadcastLaneFloat4<2>(factors)));
+    storeFloat4(result, addFloat4(sum, multiplyFloat4(loadFloat4(matrix + 12), broadcastLaneFloat4<3>(factors))));
+}
+
+// result = matrix * {x, y, z, 1}, skipping the multiplication by one.
+inline void transformPositionFloat4(const float* matrix, float x, float y, float z, float* result)
+{
+    Float4 sum = multiplyFloat4(loadFloat4(matrix), broadcastFloat4(x));
+    sum = addFloat4(sum, multiplyFloat4(loadFloat4(matrix + 4), broadcastFloat4(y)));
+    sum = addFloat4(sum, multiplyFloat4(loadFloat4(matrix + 8), broadcastFloat4(z)));
+    storeFloat4(result, addFloat4(sum, loadFloat4(matrix + 12)));
+}
+
+// result = lhs * rhs, result must not alias lhs.
+inline void multiplyMatrix4Float4(const float* lhs, const float* rhs, float* result)
+{
+#if defined(__AVX__)
+    // Two result columns at once, with lhs's columns in both halves.
+    const __m256 lhs_columns[4] = {
+        _mm256_broadcast_ps(reinterpret_cast<const __m128*>(lhs)),
+        _mm256_broadcast_ps(reinterpret_cast<const __m128*>(lhs + 4)),
+        _mm256_broadcast_ps(reinterpret_cast<const __m128*>(lhs + 8)),
+        _mm256_broadcast_ps(reinterpret_cast<const __m128*>(lhs + 12))
+    };
+    for (int32 col = 0; col < 4; col += 2) {
+        const __m256 factors = _mm256_loadu_ps(rhs + 4 * col);
+        __m256 sum = _mm256_mul_ps(lhs_columns[0], _mm256_permute_ps(factors, _MM_SHUFFLE(0, 0, 0, 0)));
+        sum = _mm256_add_ps(sum, _mm256_mul_ps(lhs_columns[1], _mm256_permute_ps(factors, _MM_SHUFFLE(1, 1, 1, 1))));
+        sum = _mm256_add_ps(sum, _mm256_mul_ps(lhs_columns[2], _mm256_permute_ps(factors, _MM_SHUFFLE(2, 2, 2, 2))));
+        sum = _mm256_add_ps(sum, _mm256_mul_ps(lhs_columns[3], _mm256_permute_ps(factors, _MM_SHUFFLE(3, 3, 3, 3))));
+        _mm256_storeu_ps(result + 4 * col, sum);
+    }
+#else
+    for (int32 col = 0; col < 4; ++col) {
+        transformFloat4(lhs, rhs + 4 * col, result + 4 * col);
+    }
+#endif
+}
+
+// result = transpose of matrix, result must not alias matrix.
+inline void transposeMatrix4Float4(const float* matrix, float* result)
+{
+#if defined(__AVX__)
+    // Columns {a, b} and {c, d}, interleaved to rows {0, 2} and {1, 3}.
+    const __m256 columns_01 = _mm256_loadu_ps(matrix);
+    const __m256 columns_23 = _mm256_loadu_ps(matrix + 8);
+    const __m256 ac_low = _mm256_unpacklo_ps(columns_01, columns_23);
+    const __m256 ac_high = _mm256_unpackhi_ps(columns_01, columns_23);
+    const __m256 ac = _mm256_permute2f128_ps(ac_low, ac_high, 0x20);
+    const __m256 bd = _mm256_permute2f128_ps(ac_low, ac_high, 0x31);
+    const __m256 rows_02 = _mm256_unpacklo_ps(ac, bd);
+    const __m256 rows_13 = _mm256_unpackhi_ps(ac, bd);
+    _mm256_storeu_ps(result, _mm256_permute2f128_ps(rows_02, rows_13, 0x20));
+    _mm256_storeu_ps(result + 8, _mm256_permute2f128_ps(rows_02, rows_13, 0x31));
+#elif defined(__SSE__)
+    Float4 col_0 = loadFloat4(matrix);
+    Float4 col_1 = loadFloat4(matrix + 4);
+    Float4 col_2 = loadFloat4(matrix + 8);
+    Float4 col_3 = loadFloat4(matrix + 12);
+    _MM_TRANSPOSE4_PS(col_0, col_1, col_2, col_3);
+    storeFloat4(result, col_0);
+    storeFloat4(result + 4, col_1);
+    storeFloat4(result + 8, col_2);
+    storeFloat4(result + 12, col_3);
+#elif defined(__ARM_NEON)
+    // De-interleaving load, i.e. every fourth element into the same register.
+    const float32x4x4_t rows = vld4q_f32(matrix);
+    storeFloat4(result, rows.val[0]);
+    storeFloat4(result + 4, rows.val[1]);
+    storeFloat4(result + 8, rows.val[2]);
+    storeFloat4(result + 12, rows.val[3]);
+#endif
+}
+#endif
+
+} // namespace MicroRenderer
@@ -4,14 +4,14 @@
 
 #pragma once
 #include "ScalarTypes.h"
-#include "cmath"
+#include "ScalarMath.h"
 
 namespace MicroRenderer {
 
 template<typename T>
 class Vector2 {
 public:
-    static_assert(std::is_arithmetic_v<T>, "Template type of Vector2<T> must be arithmetic!");
+    static_assert(is_render_scalar_v<T>, "Template type of Vector2<T> must be a scalar type!");
 
     // Component values.
     union {
@@ -195,14 +195,14 @@ public:
 
     // Get length.
     T length() const {
-        return std::sqrt(x * x + y * y);
+        return sqrt(x * x + y * y);
     }
 
     // Normalization with zero-check.
     void normalizeSafe(T epsilon = static_cast<T>(0.001)) {
         T sqLength = squaredLength();
         if (sqLength > epsilon) {
-            *this /= std::sqrt(sqLength);
+            *this /= sqrt(sqLength);
         }
     }
 
@@ -215,7 +215,7 @@ public:
     Vector2 getNormalized(T epsilon = static_cast<T>(0.001)) const {
         T sqLength = squaredLength();
         if (sqLength > epsilon) {
-            return *this / std::sqrt(sqLength);
+            return *this / sqrt(sqLength);
         }
         return {static_cast<T>(0.0)};
     }
@@ -5,14 +5,14 @@
 #pragma once
 #include "ScalarTypes.h"
 #include "Vector2.h"
-#include "cmath"
+#include "ScalarMath.h"
 
 namespace MicroRenderer {
 
 template<typename T>
 class Vector3 {
 public:
-    static_assert(std::is_arithmetic_v<T>, "Template type of Vector3<T> must be arithmetic!");
+    static_assert(is_render_scalar_v<T>, "Template type of Vector3<T> must be a scalar type!");
 
     // Component values.
     union {
@@ -226,14 +226,14 @@ public:
 
     // Get length.
     T length() const {
-        return std::sqrt(x * x + y * y + z * z);
+        return sqrt(x * x + y * y + z * z);
     }
 
     // Normalization with zero-check.
     void normalizeSafe(T epsilon = static_cast<T>(0.001)) {
         T sqLength = squaredLength();
         if (sqLength > epsilon) {
-            *this /= std::sqrt(sqLength);
+            *this /= sqrt(sqLength);
         }
         else {
             *this = {static_cast<T>(0.0)};
@@ -249,7 +249,7 @@ public:
     Vector3 getNormalized(T epsilon = static_cast<T>(0.001)) const {
         T sqLength = squaredLength();
         if (sqLength > epsilon) {
-            return *this / std::sqrt(sqLength);
+            return *this / sqrt(sqLength);
         }
         return {static_cast<T>(0.0)};
     }
@@ -6,14 +6,15 @@
 #include "ScalarTypes.h"
 #include "Vector3.h"
 #include "Vector2.h"
-#include "cmath"
+#include "ScalarMath.h"
+#include "SimdMath.h"
 
 namespace MicroRenderer {
 
 template<typename T>
 class Vector4 {
 public:
-    static_assert(std::is_arithmetic_v<T>, "Template type of Vector4<T> must be arithmetic!");
+    static_assert(is_render_scalar_v<T>, "Template type of Vector4<T> must be a scalar type!");
 
     // Component values.
     union {
@@ -147,6 +148,12 @@ public:
 
     // Addition operators.
     constexpr Vector4& operator+=(const Vector4& rhs) {
+        if constexpr (simd_vector_math<T>) {
+            if (!std::is_constant_evaluated()) {
+                storeFloat4(components, addFloat4(loadFloat4(components), loadFloat4(rhs.components)));
+                return *this;
+            }
+        }
         x += rhs.x;
         y += rhs.y;
         z += rhs.z;
@@ -158,6 +165,12 @@ public:
         return lhs;
     }
     constexpr Vector4& operator+=(const T& rhs) {
+        if constexpr (simd_vector_math<T>) {
+            if (!std::is_constant_evaluated()) {
+                storeFloat4(components, addFloat4(loadFloat4(components), broadcastFloat4(rhs)));
+                return *this;
+            }
+        }
         x += rhs;
         y += rhs;
         z += rhs;
@@ -175,6 +188,12 @@ public:
 
     // Subtraction operators.
     constexpr Vector4& operator-=(const Vector4& rhs) {
+        if constexpr (simd_vector_math<T>) {
+            if (!std::is_constant_evaluated()) {
+                storeFloat4(components, subtractFloat4(loadFloat4(components), loadFloat4(rhs.components)));
+                return *this;
+            }
+        }
         x -= rhs.x;
         y -= rhs.y;
         z -= rhs.z;
@@ -186,6 +205,12 @@ public:
         return lhs;
     }
     constexpr Vector4& operator-=(const T& rhs) {
+        if constexpr (simd_vector_math<T>) {
+            if (!std::is_constant_evaluated()) {
+                storeFloat4(components, subtractFloat4(loadFloat4(components), broadcastFloat4(rhs)));
+                return *this;
+            }
+        }
         x -= rhs;
         y -= rhs;
         z -= rhs;
@@ -204,6 +229,12 @@ public:
 
     // Multiplication operators.
     constexpr Vector4& operator*=(const Vector4& rhs) {
+        if constexpr (simd_vector_math<T>) {
+            if (!std::is_constant_evaluated()) {
+                storeFloat4(components, multiplyFloat4(loadFloat4(components), loadFloat4(rhs.components)));
+                return *this;
+            }
+        }
         x *= rhs.x;
         y *= rhs.y;
         z *= rhs.z;
@@ -215,6 +246,12 @@ public:
         return lhs;
     }
     constexpr Vector4& operator*=(const T& rhs) {
+        if constexpr (simd_vector_math<T>) {
+            if (!std::is_constant_evaluated()) {
+                storeFloat4(components, multiplyFloat4(loadFloat4(components), broadcastFloat4(rhs)));
+                return *this;
+            }
+        }
         x *= rhs;
         y *= rhs;
         z *= rhs;
@@ -266,14 +303,14 @@ public:
 
     // Get length.
     T length() const {
-        return std::sqrt(x * x + y * y + z * z + w * w);
+        return sqrt(x * x + y * y + z * z + w * w);
     }
 
     // Normalization with zero-check.
     void normalizeSafe(T epsilon = static_cast<T>(0.001)) {
         T sqLength = squaredLength();
         if (sqLength > epsilon) {
-            *this /= std::sqrt(sqLength);
+            *this /= sqrt(sqLength);
         }
     }
 
@@ -286,7 +323,7 @@ public:
     Vector4 getNormalized(T epsilon = static_cast<T>(0.001)) const {
         T sqLength = squaredLength();
         if (sqLength > epsilon) {
-            return *this / std::sqrt(sqLength);
+            return *this / sqrt(sqLength);
         }
         return {static_cast<T>(0.0)};
     }
@@ -0,0 +1,50 @@
+#pragma once
+#include "Vector3.h"
+#include "Vector4.h"
+
+namespace MicroRenderer {
+
+// N vectors in structure-of-arrays form, so that operations applied lane by lane can be vectorized by the compiler.
+template<typename T, int32 N>
+struct Vector3Batch
+{
+    T x[N];
+    T y[N];
+    T z[N];
+
+    void set(int32 lane, const Vector3<T>& vector)
+    {
+        x[lane] = vector.x;
+        y[lane] = vector.y;
+        z[lane] = vector.z;
+    }
+
+    Vector3<T> get(int32 lane) const
+    {
+        return {x[lane], y[lane], z[lane]};
+    }
+};
+
+template<typename T, int32 N>
+struct Vector4Batch
+{
+    T x[N];
+    T y[N];
+    T z[N];
+    T w[N];
+
+    void set(int32 lane, const Vector4<T>& vector)
+    {
+        x[lane] = vector.x;
+        y[lane] = vector.y;
+        z[lane] = vector.z;
+        w[lane] = vector.w;
+    }
+
+    Vector4<T> get(int32 lane) const
+    {
+        return {x[lane], y[lane], z[lane], w[lane]};
+    }
+};
+
+} // namespace MicroRenderer
@@ -6,6 +6,13 @@
 
 // Core
 #include "MicroRenderer/Core/Renderer.h"
+#include "MicroRenderer/Core/FrameTimeHistogram.h"
+#ifdef MICRORENDERER_MULTITHREADING
+#include "MicroRenderer/Core/TileScheduler.h"
+#endif
+#ifdef MICRORENDERER_SIMD
+#include "MicroRenderer/Core/SimdDepthTest.h"
+#endif
 
 // Core/Shading
 #include "MicroRenderer/Shading/ShaderConfiguration.h"
@@ -23,10 +30,14 @@
 // Math
 #include "MicroRenderer/Math/Matrix4.h"
 #include "MicroRenderer/Math/Matrix3.h"
+#include "MicroRenderer/Math/FixedPoint.h"
+#include "MicroRenderer/Math/ScalarMath.h"
 #include "MicroRenderer/Math/ScalarTypes.h"
+#include "MicroRenderer/Math/SimdMath.h"
 #include "MicroRenderer/Math/Transform.h"
 #include "MicroRenderer/Math/Utility.h"
 #include "MicroRenderer/Math/Vector2.h"
 #include "MicroRenderer/Math/Vector3.h"
 #include "MicroRenderer/Math/Vector4.h"
+#include "MicroRenderer/Math/VectorBatch.h"
 #include "MicroRenderer/Math/Interpolation.h"
@@ -15,16 +15,27 @@ public:
     using ShaderInterface_type = Interface<T, t_cfg>;
     USE_SHADER_INTERFACE(ShaderInterface_type);
 
+    // Fragment shaders of triangle buffers with packed ShaderAttributes may omit interpolateAttributes_implementation.
     template<IncrementationMode mode>
     static void interpolateAttributes(UniformData uniform, TriangleBuffer* triangle, int32 offset)
     {
-        Derived<T, t_cfg>::template interpolateAttributes_implementation<mode>(uniform, triangle, offset);
+        if constexpr (requires { Derived<T, t_cfg>::template interpolateAttributes_implementation<mode>(uniform, triangle, offset); }) {
+            Derived<T, t_cfg>::template interpolateAttributes_implementation<mode>(uniform, triangle, offset);
+        }
+        else {
+            triangle->attributes.template increment<mode>(offset);
+        }
     }
 
     static ShaderOutput computeColor(UniformData uniform, TriangleBuffer* triangle)
     {
         return Derived<T, t_cfg>::computeColor_implementation(uniform, triangle);
     }
+
+    static void computeColorSpan(UniformData uniform, const TriangleBuffer* triangle, ColorSpan span)
+    {
+        Derived<T, t_cfg>::computeColorSpan_implementation(uniform, triangle, span);
+    }
 };
 
 } // namespace MicroRenderer
@@ -43,6 +43,22 @@ enum ShadingMode : uint32
     NUM_SHADING_MODES
 };
 
+enum AttributePrecision : uint32
+{
+    ATTRIBUTES_FULL_PRECISION,
+    ATTRIBUTES_MIXED_PRECISION, // Store attribute increments in a narrower scalar type, accumulate values in T.
+    NUM_ATTRIBUTE_PRECISIONS
+};
+
+// Interpolates packed attributes divided by w and 1 / w, and divides them by 1 / w only every perspective_span_size
+// pixels along a scanline with linear interpolation in between.
+enum PerspectiveCorrectionMode : uint32
+{
+    PERSPECTIVE_CORRECTION_ENABLED,
+    PERSPECTIVE_CORRECTION_DISABLED,
+    NUM_PERSPECTIVE_CORRECTION_MODES
+};
+
 struct ShaderOutput
 {
     TextureInternalFormat format;
@@ -58,6 +74,10 @@ struct ShaderConfiguration
     DepthTestMode depth_test;
     ShadingMode shading;
     ShaderOutput output;
+    AttributePrecision attribute_precision = ATTRIBUTES_FULL_PRECISION;
+    PerspectiveCorrectionMode perspective_correction = PERSPECTIVE_CORRECTION_DISABLED;
+    // Pixels between divisions with perspective correction, a power of two.
+    int32 perspective_span_size = 16;
 };
 
 } // namespace MicroRenderer
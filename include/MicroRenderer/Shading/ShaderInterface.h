@@ -6,11 +6,18 @@
 #include "MicroRenderer/Shading/ShaderConfiguration.h"
 #include "MicroRenderer/Math/Vector3.h"
 #include "MicroRenderer/Math/Vector4.h"
+#include "MicroRenderer/Math/VectorBatch.h"
 #include "MicroRenderer/Textures/Texture2D.h"
 #include "MicroRenderer/Math/Interpolation.h"
 
 namespace MicroRenderer {
 
+// Number of consecutive vertices shaded at once by vertex shaders implementing shadeVertices_implementation.
+constexpr int32 vertex_batch_size = 8;
+
+// Maximum number of pixels shaded at once by fragment shaders implementing computeColorSpan_implementation.
+constexpr int32 color_span_size = 32;
+
 struct BaseInstanceData
 {
     uint16 model_idx = 0;
@@ -49,10 +56,30 @@ struct BaseVertexBuffer
     }
 };
 
+// Triangle attribute for use in TriangleBuffers, with increments narrowed according to the attribute precision.
+template<typename T, ShaderConfiguration t_cfg, typename AttrType>
+using ShaderAttribute = TriangleAttribute<T, AttrType, std::conditional_t<t_cfg.attribute_precision == ATTRIBUTES_MIXED_PRECISION,
+                                                                        NarrowAttribute_t<AttrType>, AttrType>>;
+
+// Packed list of triangle attributes for use in TriangleBuffers as member 'attributes', with increments narrowed
+// according to the attribute precision. Fragment shaders and triangle assemblers then need not interpolate and set up
+// the attributes themselves, see BaseFragmentShader and BaseTriangleAssembler.
+template<typename T, ShaderConfiguration t_cfg, typename... AttrTypes>
+using ShaderAttributes = PackedTriangleAttributes<T, std::conditional_t<t_cfg.attribute_precision == ATTRIBUTES_MIXED_PRECISION,
+                                                                        NarrowScalar_t<T>, T>, AttrTypes...>;
+
 template<typename T, ShaderConfiguration t_cfg>
 struct BaseTriangleBuffer
 {
+    // Depth increments are tiny and the depth test relies on their precision, so they are never narrowed.
     std::conditional_t<t_cfg.depth_test == DEPTH_TEST_ENABLED, TriangleAttribute<T, T>, std::monostate> depth;
+    // 1 / w for perspective correction, never narrowed either, as attributes are divided by it.
+    std::conditional_t<t_cfg.perspective_correction == PERSPECTIVE_CORRECTION_ENABLED, TriangleAttribute<T, T>, std::monostate> inv_w;
+
+    // Whether all attributes are flat per triangle, i.e. set up once and never interpolated. Derived buffers shadow this
+    // with true. Otherwise packed ShaderAttributes tell it per triangle from their increments. Either lets the renderer
+    // fill depth-tested spans of such triangles with a single color.
+    static constexpr bool flat_attributes = false;
 };
 
 struct TriangleIndices
@@ -62,6 +89,29 @@ struct TriangleIndices
     uint16 vertex_3_idx;
 };
 
+// Axis-aligned bounding box of a model's vertex positions in model space.
+template<typename T>
+struct ModelBounds
+{
+    Vector3<T> min;
+    Vector3<T> max;
+};
+
+// Consecutive range of a model's triangles, with bounds and a cone around the normals of its triangles, i.e. the
+// cross products (v2 - v1) x (v3 - v1), for rejecting all of them at once.
+template<typename T>
+struct ModelCluster
+{
+    uint16 first_triangle;
+    uint16 num_triangles;
+    ModelBounds<T> bounds;
+    Vector3<T> cone_axis;
+    // Cosine and sine of the largest angle between the axis and a normal. Clusters with a cosine <= 0 can not be
+    // back-facing as a whole.
+    T cone_cos;
+    T cone_sin;
+};
+
 template <typename T, ShaderConfiguration t_cfg, template <typename> class GlobalData,
           template <typename> class InstanceData, template <typename> class VertexSource,
           template <typename, ShaderConfiguration> class VertexBuffer,
@@ -97,12 +147,34 @@ public:
         const VertexSource_type* source;
         VertexBuffer_type* buffer;
     };
+    // Vertices shaded at once. Vertex shaders write the (unhomogenized) screen positions into the structure-of-arrays
+    // positions instead of the vertex buffers, the renderer homogenizes them for the whole batch.
+    struct VertexBatch
+    {
+        const VertexSource_type* sources;
+        VertexBuffer_type* buffers;
+        Vector4Batch<T, vertex_batch_size>* positions;
+    };
+    // Consecutive pixels of a scanline shaded at once. The triangle buffer holds the attributes at the first pixel,
+    // pixel i is i increments in x further. Colors are only needed for pixels whose bit is set in the mask, i.e. that
+    // passed the depth test, and are written to colors[i].
+    struct ColorSpan
+    {
+        int32 length;
+        uint32 mask;
+        ShaderOutput_type* colors;
+    };
     struct ModelData
     {
         uint16 num_vertices;
         uint16 num_triangles;
         const VertexSource_type* vertices;
         const TriangleIndices* indices;
+        // Optional, lets the renderer skip instances that are entirely outside the screen or behind the near plane.
+        const ModelBounds<T>* bounds = nullptr;
+        // Optional, lets the renderer skip clusters of triangles that are off screen or back-facing as a whole.
+        uint16 num_clusters = 0;
+        const ModelCluster<T>* clusters = nullptr;
     };
 };
 
@@ -115,6 +187,8 @@ public:
     using VertexSource = typename Interface::VertexSource_type; \
     using VertexBuffer = typename Interface::VertexBuffer_type; \
     using VertexData = typename Interface::VertexData; \
+    using VertexBatch = typename Interface::VertexBatch; \
+    using ColorSpan = typename Interface::ColorSpan; \
     using TriangleBuffer = typename Interface::TriangleBuffer_type; \
     using ModelData = typename Interface::ModelData;
 
@@ -26,6 +26,12 @@ public:
     static_assert(t_cfg.clipping < NUM_CLIPPING_MODES, "ShaderProgram: Invalid clipping mode in configuration!");
     static_assert(t_cfg.depth_test < NUM_DEPTH_TEST_MODES, "ShaderProgram: Invalid depth test mode in configuration!");
     static_assert(t_cfg.shading < NUM_SHADING_MODES, "ShaderProgram: Invalid shading mode in configuration!");
+    static_assert(t_cfg.attribute_precision < NUM_ATTRIBUTE_PRECISIONS, "ShaderProgram: Invalid attribute precision in configuration!");
+    static_assert(t_cfg.perspective_correction < NUM_PERSPECTIVE_CORRECTION_MODES, "ShaderProgram: Invalid perspective correction mode in configuration!");
+    static_assert(t_cfg.perspective_correction == PERSPECTIVE_CORRECTION_DISABLED || t_cfg.projection == PERSPECTIVE,
+                  "ShaderProgram: Perspective correction requires perspective projection!");
+    static_assert(t_cfg.perspective_span_size > 0 && (t_cfg.perspective_span_size & (t_cfg.perspective_span_size - 1)) == 0,
+                  "ShaderProgram: Perspective span size must be a power of two!");
     static_assert(t_cfg.projection != PERSPECTIVE || t_cfg.clipping == CLIP_AT_NEAR_PLANE,
                   "ShaderProgram: Perspective projection requires clipping at near plane to be enabled!");
     static_assert(t_cfg.depth_test == DEPTH_TEST_ENABLED || t_cfg.shading == SHADING_ENABLED,
@@ -35,6 +41,18 @@ public:
                   "ShaderProgram: ShaderInterface type used in VertexShader, TriangleAssembler and FragmentShader must match!");
 
     static constexpr ShaderConfiguration configuration = t_cfg;
+    // Whether the vertex shader can shade vertex_batch_size vertices at once.
+    static constexpr bool batched_vertex_shading = requires(UniformData uniform, VertexBatch batch) {
+        VertexShader_type::shadeVertices_implementation(uniform, batch);
+    };
+    // Whether the fragment shader can compute the colors of a span of pixels at once.
+    static constexpr bool span_shading = requires(UniformData uniform, const TriangleBuffer* triangle, ColorSpan span) {
+        FragmentShader_type::computeColorSpan_implementation(uniform, triangle, span);
+    };
+    // Whether triangles' attributes are flat, or packed attributes tell whether they are constant along scanlines.
+    static constexpr bool flat_triangles = TriangleBuffer::flat_attributes || requires(const TriangleBuffer* triangle) {
+        triangle->attributes.isConstantInX();
+    };
     using InverseNearPlaneType = std::conditional_t<t_cfg.projection == PERSPECTIVE, T, std::monostate>;
 
     void setGlobalData(const GlobalData* data)
@@ -55,6 +73,11 @@ public:
         VertexShader_type::shadeVertex(uniform_data, vertex);
     }
 
+    void shadeVertices(VertexBatch batch) requires(batched_vertex_shading)
+    {
+        VertexShader_type::shadeVertices(uniform_data, batch);
+    }
+
     void interpolateVertices(VertexData from, VertexData to, VertexSource* new_src, VertexBuffer* new_buf)
     {
         // Get clip position based on projection mode.
@@ -97,6 +120,11 @@ public:
             const T rev_z_3 = static_cast<T>(1.0) - pos_3.z;
             triangle->depth.initialize(rev_z_1, rev_z_2, rev_z_3, bc_incs, v1_offset);
         }
+        if constexpr (t_cfg.perspective_correction == PERSPECTIVE_CORRECTION_ENABLED) {
+            // Clip positions hold 1 / w after homogenization.
+            triangle->inv_w.initialize(v1.buffer->clip_position.w, v2.buffer->clip_position.w,
+                                       v3.buffer->clip_position.w, bc_incs, v1_offset);
+        }
 
         TriangleAssembler_type::setupTriangle(uniform_data, tri_idx, v1, v2, v3, triangle, v1_offset, bc_incs);
     }
@@ -108,14 +136,50 @@ public:
             // Interpolate depth.
             triangle->depth.template increment<mode>(offset);
         }
+        if constexpr (t_cfg.perspective_correction == PERSPECTIVE_CORRECTION_ENABLED) {
+            triangle->inv_w.template increment<mode>(offset);
+        }
+
+        FragmentShader_type::template interpolateAttributes<mode>(uniform_data, triangle, offset);
+    }
 
+    // Interpolates the fragment shader's attributes without depth.
+    template<IncrementationMode mode>
+    void interpolateShaderAttributes(TriangleBuffer* triangle, int32 offset = 1)
+    {
         FragmentShader_type::template interpolateAttributes<mode>(uniform_data, triangle, offset);
     }
 
+    template<IncrementationMode mode>
+    void interpolateDepth(TriangleBuffer* triangle, int32 offset = 1) requires(t_cfg.depth_test == DEPTH_TEST_ENABLED)
+    {
+        triangle->depth.template increment<mode>(offset);
+    }
+
+    // Tells from the increments computed at setup, so call it after setupTriangle.
+    bool isConstantInX(const TriangleBuffer* triangle) const requires(flat_triangles)
+    {
+        if constexpr (TriangleBuffer::flat_attributes) {
+            return true;
+        }
+        else if constexpr (t_cfg.perspective_correction == PERSPECTIVE_CORRECTION_ENABLED) {
+            // Attributes divided by w are only constant if w is.
+            return triangle->attributes.isConstantInX() && triangle->inv_w.getIncrementX() == static_cast<T>(0.0);
+        }
+        else {
+            return triangle->attributes.isConstantInX();
+        }
+    }
+
     ShaderOutput computeColor(TriangleBuffer* triangle)
     {
         return FragmentShader_type::computeColor(uniform_data, triangle);
     }
+
+    void computeColorSpan(const TriangleBuffer* triangle, ColorSpan span) requires(span_shading)
+    {
+        FragmentShader_type::computeColorSpan(uniform_data, triangle, span);
+    }
 private:
     UniformData uniform_data;
 
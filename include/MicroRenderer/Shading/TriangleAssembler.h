@@ -23,10 +23,33 @@ public:
     {
         Derived<T, t_cfg>::interpolateVertices_implementation(uniform, from, to, new_src, new_buf, from_factor, to_factor);
     }
+    // Triangle assemblers of triangle buffers with packed ShaderAttributes may implement getVertexAttributes_implementation,
+    // returning a vertex's values of all attributes as tuple, instead of setting them up in setupTriangle_implementation.
+    // Both are optional, but perspective correction requires the former.
     static void setupTriangle(UniformData uniform, uint32 tri_idx, VertexData v1, VertexData v2, VertexData v3,
                               TriangleBuffer* triangle, Vector2<T> v1_offset, const BarycentricIncrements<T>& bc_incs)
     {
-        Derived<T, t_cfg>::setupTriangle_implementation(uniform, tri_idx, v1, v2, v3, triangle, v1_offset, bc_incs);
+        constexpr bool packed_attributes = requires { Derived<T, t_cfg>::getVertexAttributes_implementation(uniform, v1); };
+        static_assert(packed_attributes || t_cfg.perspective_correction == PERSPECTIVE_CORRECTION_DISABLED,
+                      "TriangleAssembler: Perspective correction requires getVertexAttributes_implementation!");
+        if constexpr (t_cfg.perspective_correction == PERSPECTIVE_CORRECTION_ENABLED) {
+            // Attributes divided by w.
+            const Vector3<T> inv_w = {v1.buffer->clip_position.w, v2.buffer->clip_position.w, v3.buffer->clip_position.w};
+            triangle->attributes.initialize(Derived<T, t_cfg>::getVertexAttributes_implementation(uniform, v1),
+                                            Derived<T, t_cfg>::getVertexAttributes_implementation(uniform, v2),
+                                            Derived<T, t_cfg>::getVertexAttributes_implementation(uniform, v3),
+                                            bc_incs, v1_offset, inv_w);
+        }
+        else if constexpr (packed_attributes) {
+            triangle->attributes.initialize(Derived<T, t_cfg>::getVertexAttributes_implementation(uniform, v1),
+                                            Derived<T, t_cfg>::getVertexAttributes_implementation(uniform, v2),
+                                            Derived<T, t_cfg>::getVertexAttributes_implementation(uniform, v3),
+                                            bc_incs, v1_offset);
+        }
+        if constexpr (requires { Derived<T, t_cfg>::setupTriangle_implementation(uniform, tri_idx, v1, v2, v3, triangle,
+                                                                                 v1_offset, bc_incs); }) {
+            Derived<T, t_cfg>::setupTriangle_implementation(uniform, tri_idx, v1, v2, v3, triangle, v1_offset, bc_incs);
+        }
     }
 };
 
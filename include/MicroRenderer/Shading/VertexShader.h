@@ -3,6 +3,7 @@
 //
 
 #pragma once
+#include <concepts>
 #include "MicroRenderer/Shading/ShaderInterface.h"
 
 namespace MicroRenderer {
@@ -19,6 +20,26 @@ public:
     {
         Derived<T, t_cfg>::shadeVertex_implementation(uniform, vertex);
     }
+
+    static void shadeVertices(UniformData uniform, VertexBatch batch)
+    {
+        Derived<T, t_cfg>::shadeVertices_implementation(uniform, batch);
+    }
+
+    // Default batched path, transforms the positions of the whole batch into (unhomogenized) screen space. Derived
+    // shaders whose shadeVertex_implementation does more than that must implement their own.
+    static void shadeVertices_implementation(UniformData uniform, VertexBatch batch)
+        requires requires(UniformData uniform_data, const VertexSource& source) {
+            { source.position } -> std::convertible_to<Vector3<T>>;
+            uniform_data.instance->model_screen_tf;
+        }
+    {
+        Vector3Batch<T, vertex_batch_size> model_positions;
+        for (int32 lane = 0; lane < vertex_batch_size; ++lane) {
+            model_positions.set(lane, batch.sources[lane].position);
+        }
+        uniform.instance->model_screen_tf.transformPositions(model_positions, *batch.positions);
+    }
 };
 
 } // namespace MicroRenderer
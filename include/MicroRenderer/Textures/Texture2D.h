@@ -3,6 +3,7 @@
 //
 
 #pragma once
+#include "MicroRenderer/Math/FixedPoint.h"
 #include "MicroRenderer/Math/ScalarTypes.h"
 #include "TextureConfiguration.h"
 #include "TextureTypes.h"
@@ -85,6 +86,10 @@ public:
 
     bool verifyBufferPosition(BufferPosition position) const;
 private:
+    // Conversion between WorkingType channel values and normalized ExternalType values in [0, 1].
+    static ExternalType normalizedToExternal(const WorkingType& pixel);
+
+    static WorkingType externalToNormalized(const ExternalType& value);
 
     // Texture width.
     int32 texture_width = 0;
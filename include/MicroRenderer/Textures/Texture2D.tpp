@@ -7,6 +7,7 @@
 #include <algorithm>
 #include <cassert>
 #include <fstream>
+#include <iterator>
 
 namespace MicroRenderer {
 
@@ -135,7 +136,7 @@ namespace MicroRenderer {
     template<typename T, TextureConfiguration t_cfg>
     typename Texture2D<T, t_cfg>::ExternalType Texture2D<T, t_cfg>::readPixelAt(Vector2<T> uv) const
     {
-        return readPixelAt(std::lround(uv.x * texture_width - static_cast<T>(0.5)), std::lround(uv.y * texture_height - static_cast<T>(0.5)));
+        return readPixelAt(lround(uv.x * texture_width - static_cast<T>(0.5)), lround(uv.y * texture_height - static_cast<T>(0.5)));
     }
 
     template<typename T, TextureConfiguration t_cfg>
@@ -199,8 +200,7 @@ namespace MicroRenderer {
             return static_cast<ExternalType>(pixel);
         }
         else if constexpr (t_cfg.type == TYPE_NORMALIZED) {
-            constexpr auto inv_max_values = ExternalType{1.0} / static_cast<ExternalType>(TextureInternal<t_cfg.format, T>::MaxValue);
-            return static_cast<ExternalType>(pixel) * inv_max_values;
+            return normalizedToExternal(pixel);
         }
     }
 
@@ -213,7 +213,7 @@ namespace MicroRenderer {
     template<typename T, TextureConfiguration t_cfg>
     void Texture2D<T, t_cfg>::drawPixelAt(Vector2<T> uv, const ExternalType& value) requires(t_cfg.access == ACCESS_READWRITE)
     {
-        drawPixelAt(std::lround(uv.x * texture_width - static_cast<T>(0.5)), std::lround(uv.y * texture_height - static_cast<T>(0.5)), value);
+        drawPixelAt(lround(uv.x * texture_width - static_cast<T>(0.5)), lround(uv.y * texture_height - static_cast<T>(0.5)), value);
     }
 
     template<typename T, TextureConfiguration t_cfg>
@@ -234,8 +234,7 @@ namespace MicroRenderer {
             pixel = static_cast<WorkingType>(value);
         }
         else if constexpr (t_cfg.type == TYPE_NORMALIZED) {
-            constexpr auto max_values = static_cast<ExternalType>(TextureInternal<t_cfg.format, T>::MaxValue);
-            pixel = static_cast<WorkingType>(value * max_values);
+            pixel = externalToNormalized(value);
         }
 
         // Apply pixel channel swizzle.
@@ -308,10 +307,10 @@ namespace MicroRenderer {
         uv.x *= texture_width;
         uv.y *= texture_height;
         uv -= Vector2<T>(0.5);
-        T left_x = std::floor(uv.x);
-        T right_x = std::ceil(uv.x);
-        T top_y = std::floor(uv.y);
-        T bottom_y = std::ceil(uv.y);
+        T left_x = floor(uv.x);
+        T right_x = ceil(uv.x);
+        T top_y = floor(uv.y);
+        T bottom_y = ceil(uv.y);
         ExternalType top_left = readPixelAt(static_cast<int32>(left_x), static_cast<int32>(top_y));
         ExternalType top_right = readPixelAt(static_cast<int32>(right_x), static_cast<int32>(top_y));
         ExternalType bottom_left = readPixelAt(static_cast<int32>(left_x), static_cast<int32>(bottom_y));
@@ -369,7 +368,7 @@ namespace MicroRenderer {
                 ExternalType value = readPixelAt(x, y);
                 if constexpr (t_cfg.format == FORMAT_DEPTH) {
                     value = std::clamp(value, static_cast<T>(0.0), static_cast<T>(1.0));
-                    file << std::to_string(static_cast<uint32>(value * static_cast<T>(65535.0))) << "\n";
+                    file << std::to_string(static_cast<uint32>(static_cast<double>(value) * 65535.0)) << "\n";
                     continue;
                 }
 
@@ -382,8 +381,7 @@ namespace MicroRenderer {
                     pixel = static_cast<WorkingType>(value);
                 }
                 else if constexpr (t_cfg.type == TYPE_NORMALIZED) {
-                    constexpr auto max_values = static_cast<ExternalType>(TextureInternal<t_cfg.format, T>::MaxValue);
-                    pixel = static_cast<WorkingType>(value * max_values);
+                    pixel = externalToNormalized(value);
                 }
 
                 // Insert pixel into file stream, based on texture format and swizzle.
@@ -413,6 +411,59 @@ namespace MicroRenderer {
         return true;
     }
 
+    template<typename T, TextureConfiguration t_cfg>
+    typename Texture2D<T, t_cfg>::ExternalType Texture2D<T, t_cfg>::normalizedToExternal(const WorkingType& pixel)
+    {
+        constexpr WorkingType max_values = TextureInternal<t_cfg.format, T>::MaxValue;
+        if constexpr (is_fixed_point_v<T>) {
+            // Scale in integer arithmetic rounding to nearest, channel maximum values may exceed the fixed-point range.
+            constexpr auto normalize = [](uint32 value, uint32 max_value) {
+                return T::fromRaw(static_cast<decltype(T::ONE)>((static_cast<uint64>(value) * T::ONE + max_value / 2) / max_value));
+            };
+            if constexpr (std::is_arithmetic_v<WorkingType>) {
+                return normalize(pixel, max_values);
+            }
+            else {
+                ExternalType value;
+                for (uint32 i = 0; i < std::size(pixel.components); ++i) {
+                    value.components[i] = normalize(pixel.components[i], max_values.components[i]);
+                }
+                return value;
+            }
+        }
+        else {
+            constexpr auto inv_max_values = ExternalType{1.0} / static_cast<ExternalType>(max_values);
+            return static_cast<ExternalType>(pixel) * inv_max_values;
+        }
+    }
+
+    template<typename T, TextureConfiguration t_cfg>
+    typename Texture2D<T, t_cfg>::WorkingType Texture2D<T, t_cfg>::externalToNormalized(const ExternalType& value)
+    {
+        constexpr WorkingType max_values = TextureInternal<t_cfg.format, T>::MaxValue;
+        if constexpr (is_fixed_point_v<T>) {
+            // Clamp to [0, 1] and truncate like the floating-point conversion.
+            constexpr auto denormalize = [](T value, uint32 max_value) {
+                const auto raw = std::clamp(value.raw, static_cast<decltype(value.raw)>(0), T::ONE);
+                return static_cast<uint32>(static_cast<uint64>(raw) * max_value / T::ONE);
+            };
+            if constexpr (std::is_arithmetic_v<WorkingType>) {
+                return denormalize(value, max_values);
+            }
+            else {
+                WorkingType pixel;
+                for (uint32 i = 0; i < std::size(value.components); ++i) {
+                    pixel.components[i] = denormalize(value.components[i], max_values.components[i]);
+                }
+                return pixel;
+            }
+        }
+        else {
+            constexpr auto ext_max_values = static_cast<ExternalType>(max_values);
+            return static_cast<WorkingType>(value * ext_max_values);
+        }
+    }
+
     template<typename T, TextureConfiguration t_cfg>
     bool Texture2D<T, t_cfg>::verifyBufferPosition(BufferPosition position) const
     {
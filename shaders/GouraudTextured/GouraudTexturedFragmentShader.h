@@ -15,22 +15,10 @@ public:
     using ShaderInterface_type = GouraudTexturedShaderInterface<T, t_cfg>;
     USE_SHADER_INTERFACE(ShaderInterface_type);
 
-    template<IncrementationMode mode>
-    static void interpolateAttributes_implementation(UniformData uniform, TriangleBuffer* triangle, int32 offset)
-    {
-        // Interpolate light intensity.
-        triangle->intensity.template increment<mode>(offset);
-
-        // Interpolate uv coordinates.
-        triangle->uv.template increment<mode>(offset);
-    }
-
     static ShaderOutput computeColor_implementation(UniformData uniform, TriangleBuffer* triangle)
     {
         // Texture.
-        auto color = uniform.instance->color_texture.readPixelAt(static_cast<Vector2<T>>(triangle->uv.getValue()));
-        //const Vector3<T> intensity = triangle->intensity.getValue();
-        //return {color.g * intensity, color.b * intensity, 1.f, color.r * intensity};
+        auto color = uniform.instance->color_texture.readPixelAt(triangle->attributes.template getValue<TriangleBuffer::UV>());
         return color;
     }
 };
@@ -50,8 +50,10 @@ struct GouraudTexturedVertexBuffer : BaseVertexBuffer<T, t_cfg>
 template<typename T, ShaderConfiguration t_cfg>
 struct GouraudTexturedTriangleBuffer : BaseTriangleBuffer<T, t_cfg>
 {
-    TriangleAttribute<T, Vector3<T>> intensity;
-    TriangleAttribute<T, Vector2<T>> uv;
+    // Indices of the attributes.
+    static constexpr int32 UV = 0;
+
+    ShaderAttributes<T, t_cfg, Vector2<T>> attributes;
 };
 
 template<typename T, ShaderConfiguration t_cfg>
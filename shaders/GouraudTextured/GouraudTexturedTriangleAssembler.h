@@ -22,15 +22,11 @@ public:
         new_src->uv_coordinates = interpolateLinearly(from.source->uv_coordinates, to.source->uv_coordinates, from_factor, to_factor);
     }
 
-    static void setupTriangle_implementation(UniformData uniform, uint32 tri_idx, VertexData v1, VertexData v2,
-                                             VertexData v3, TriangleBuffer* triangle, Vector2<T> v1_offset,
-                                             const BarycentricIncrements<T>& bc_incs)
+    static std::tuple<Vector2<T>> getVertexAttributes_implementation(UniformData uniform, VertexData vertex)
     {
-        // // Setup interpolation of light intensity over triangle.
-        // triangle->intensity.initialize(v1.buffer->intensity, v2.buffer->intensity, v3.buffer->intensity, bc_incs, v1_offset);
-
-        // Setup interpolation of uv coordinates over triangle.
-        triangle->uv.initialize(v1.source->uv_coordinates, v2.source->uv_coordinates, v3.source->uv_coordinates, bc_incs, v1_offset);
+        // Interpolate uv coordinates over triangle. Light intensity is not interpolated while vertex lighting is
+        // disabled in the vertex shader.
+        return {vertex.source->uv_coordinates};
     }
 };
 
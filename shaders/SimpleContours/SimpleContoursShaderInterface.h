@@ -51,6 +51,8 @@ struct SimpleContoursVertexBuffer : BaseVertexBuffer<T, t_cfg>
 template<typename T, ShaderConfiguration t_cfg>
 struct SimpleContoursTriangleBuffer : BaseTriangleBuffer<T, t_cfg>
 {
+    static constexpr bool flat_attributes = true;
+
     Vector3<T> shading;
 };
 
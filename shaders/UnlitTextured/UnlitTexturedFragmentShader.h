@@ -3,6 +3,7 @@
 //
 
 #pragma once
+#include <bit>
 #include "MicroRenderer/Shading/FragmentShader.h"
 #include "UnlitTexturedShaderInterface.h"
 
@@ -15,20 +16,37 @@ public:
     using ShaderInterface_type = UnlitTexturedShaderInterface<T, t_cfg>;
     USE_SHADER_INTERFACE(ShaderInterface_type);
 
-    template<IncrementationMode mode>
-    static void interpolateAttributes_implementation(UniformData uniform, TriangleBuffer* triangle, int32 offset)
-    {
-        // Interpolate uv coordinates.
-        triangle->uv.template increment<mode>(offset);
-    }
-
     static ShaderOutput computeColor_implementation(UniformData uniform, TriangleBuffer* triangle)
     {
         // Return color from texture.
-        auto color = uniform.instance->color_texture.readPixelAt(static_cast<Vector2<T>>(triangle->uv.getValue()));
+        auto color = uniform.instance->color_texture.readPixelAt(triangle->attributes.template getValue<TriangleBuffer::UV>());
         //return {color.g, color.b, 15, color.r};
         return color;
     }
+
+    static void computeColorSpan_implementation(UniformData uniform, const TriangleBuffer* triangle, ColorSpan span)
+    {
+        // Texel coordinates of the whole span first, which compilers can vectorize, then reads of visible pixels only.
+        const auto& texture = uniform.instance->color_texture;
+        const Vector2<T> uv = triangle->attributes.template getValue<TriangleBuffer::UV>();
+        const Vector2<T> uv_increment = triangle->attributes.template getIncrementX<TriangleBuffer::UV>();
+        const T width = static_cast<T>(texture.getWidth());
+        const T height = static_cast<T>(texture.getHeight());
+        int32 texel_x[color_span_size];
+        int32 texel_y[color_span_size];
+        // Blocks of 8 pixels, so that short spans take a single vector iteration without a scalar remainder.
+        for (int32 block = 0; block < span.length; block += 8) {
+            for (int32 i = block; i < block + 8; ++i) {
+                // Flooring selects the texel containing the coordinate, which is the one readPixelAt(uv) rounds to.
+                texel_x[i] = floorToInt((uv.x + uv_increment.x * static_cast<T>(i)) * width);
+                texel_y[i] = floorToInt((uv.y + uv_increment.y * static_cast<T>(i)) * height);
+            }
+        }
+        for (uint32 mask = span.mask; mask != 0; mask &= mask - 1) {
+            const int32 i = std::countr_zero(mask);
+            span.colors[i] = texture.readPixelAt(texel_x[i], texel_y[i]);
+        }
+    }
 };
 
 } // namespace MicroRenderer
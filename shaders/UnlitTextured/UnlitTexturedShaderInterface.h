@@ -39,7 +39,10 @@ struct UnlitTexturedVertexBuffer : BaseVertexBuffer<T, t_cfg>
 template<typename T, ShaderConfiguration t_cfg>
 struct UnlitTexturedTriangleBuffer : BaseTriangleBuffer<T, t_cfg>
 {
-    TriangleAttribute<T, Vector2<T>> uv;
+    // Indices of the attributes.
+    static constexpr int32 UV = 0;
+
+    ShaderAttributes<T, t_cfg, Vector2<T>> attributes;
 };
 
 template<typename T, ShaderConfiguration t_cfg>
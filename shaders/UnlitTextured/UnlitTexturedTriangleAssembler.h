@@ -22,12 +22,10 @@ public:
         new_src->uv_coordinates = interpolateLinearly(from.source->uv_coordinates, to.source->uv_coordinates, from_factor, to_factor);
     }
 
-    static void setupTriangle_implementation(UniformData uniform, uint32 tri_idx, VertexData v1, VertexData v2,
-                                             VertexData v3, TriangleBuffer* triangle, Vector2<T> v1_offset,
-                                             const BarycentricIncrements<T>& bc_incs)
+    static std::tuple<Vector2<T>> getVertexAttributes_implementation(UniformData uniform, VertexData vertex)
     {
-        // Setup interpolation of uv coordinates over triangle.
-        triangle->uv.initialize(v1.source->uv_coordinates, v2.source->uv_coordinates, v3.source->uv_coordinates, bc_incs, v1_offset);
+        // Interpolate uv coordinates over triangle.
+        return {vertex.source->uv_coordinates};
     }
 };
 